@@ -0,0 +1,355 @@
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/default-simulator-impl.h"
+#include "ns3/linear-wsn-helper.h"
+#include "ns3/lwsn-fixed-slot-schedule.h"
+#include "ns3/lwsn-sensor-application.h"
+#include "ns3/lwsn-packet-pool.h"
+#include <algorithm>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+// Throughput and latency benchmark for the linear coded chain.
+//
+// Every node runs an LwsnSensorApplication that takes load readings per
+// frame, periodically or as a Poisson process, and sends each of them
+// towards both ends of the chain.  The sinks report each reading they
+// deliver with its origin and sequence number, which names the reading
+// whose send time the latency is measured from.  The result is printed
+// as one JSON object on stdout so that runs of different builds can be
+// compared by a script.
+
+namespace ns3 {
+
+/**
+ * Default simulator that counts the events scheduled through it.
+ */
+class CountingSimulatorImpl : public DefaultSimulatorImpl
+{
+public:
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::CountingSimulatorImpl")
+      .SetParent<DefaultSimulatorImpl> ()
+      .SetGroupName ("Core")
+      .AddConstructor<CountingSimulatorImpl> ()
+    ;
+    return tid;
+  }
+  virtual EventId Schedule (Time const &delay, EventImpl *event)
+  {
+    ++g_events;
+    return DefaultSimulatorImpl::Schedule (delay, event);
+  }
+  virtual void ScheduleWithContext (uint32_t context, Time const &delay, EventImpl *event)
+  {
+    ++g_events;
+    DefaultSimulatorImpl::ScheduleWithContext (context, delay, event);
+  }
+  virtual EventId ScheduleNow (EventImpl *event)
+  {
+    ++g_events;
+    return DefaultSimulatorImpl::ScheduleNow (event);
+  }
+
+  static uint64_t g_events; //!< events scheduled so far
+};
+
+uint64_t CountingSimulatorImpl::g_events = 0;
+
+NS_OBJECT_ENSURE_REGISTERED (CountingSimulatorImpl);
+
+} // namespace ns3
+
+namespace {
+
+enum Direction
+{
+  LEFT = 0,   //!< towards sid 1
+  RIGHT = 1   //!< towards sid n
+};
+
+/// Send times of the readings, per origin sid and sequence number.
+std::vector<std::vector<Time> > g_sent;
+/// Readings delivered, per direction, origin sid and sequence number.
+std::vector<std::vector<bool> > g_delivered[2];
+/// Delivery latencies in seconds, per origin sid.
+std::vector<std::vector<double> > g_latency;
+uint64_t g_generated = 0;
+uint64_t g_unmatched = 0;
+uint64_t g_duplicates = 0;
+
+void
+Reading (uint16_t osid, uint16_t n, uint32_t seq)
+{
+  std::vector<Time> &sent = g_sent[osid];
+  if (sent.size () <= seq)
+    {
+      sent.resize (seq + 1);
+    }
+  sent[seq] = Simulator::Now ();
+  g_generated += (osid != 1) + (osid != n);
+}
+
+void
+Deliver (Direction direction, uint16_t osid, uint32_t seq, uint32_t size)
+{
+  if (osid >= g_sent.size () || seq >= g_sent[osid].size ())
+    {
+      ++g_unmatched;
+      return;
+    }
+  std::vector<bool> &delivered = g_delivered[direction][osid];
+  if (delivered.size () <= seq)
+    {
+      delivered.resize (g_sent[osid].size ());
+    }
+  if (delivered[seq])
+    {
+      ++g_duplicates;
+      return;
+    }
+  delivered[seq] = true;
+  g_latency[osid].push_back ((Simulator::Now () - g_sent[osid][seq]).GetSeconds ());
+}
+
+/**
+ * \return a schedule with compiled route and delay tables if the chain
+ *         has one of the shapes they exist for, else 0
+ */
+Ptr<LwsnSlotSchedule>
+CreateFixedSchedule (uint32_t nNodes, uint32_t frameLength, bool pipelined)
+{
+  // FrameLength 0 gives the shortest frame, which these shapes use
+  if (pipelined)
+    {
+      return 0;
+    }
+  if (nNodes == 6 && (frameLength == 0 || frameLength == 13))
+    {
+      return LwsnFixedSlotSchedule<6, 13, 3>::Create ();
+    }
+  if (nNodes == 8 && (frameLength == 0 || frameLength == 22))
+    {
+      return LwsnFixedSlotSchedule<8, 22, 3>::Create ();
+    }
+  if (nNodes == 12 && (frameLength == 0 || frameLength == 38))
+    {
+      return LwsnFixedSlotSchedule<12, 38, 3>::Create ();
+    }
+  return 0;
+}
+
+double
+Percentile (const std::vector<double> &sorted, double p)
+{
+  if (sorted.empty ())
+    {
+      return 0;
+    }
+  size_t i = static_cast<size_t> (p * (sorted.size () - 1) + 0.5);
+  return sorted[i];
+}
+
+} // anonymous namespace
+
+int main (int argc, char *argv[])
+{
+  uint32_t nNodes = 6;
+  uint32_t frameLength = 0;
+  uint32_t payload = 100;
+  double load = 1.0;
+  bool poisson = false;
+  bool pipelined = false;
+  bool fixedTables = true;
+  double errorRate = 0;
+  uint32_t arq = 0;
+  bool aggregation = false;
+  uint32_t mtu = 0xffff;
+  std::string dataRate = "0b/s";
+  bool compactHeaders = false;
+  double theta = 0.1;
+  uint32_t frames = 10;
+  uint32_t drainFrames = 0;
+  uint32_t seed = 1;
+  std::string codingMode = "xor";
+
+  CommandLine cmd;
+  cmd.AddValue ("nNodes", "Number of nodes in the chain", nNodes);
+  cmd.AddValue ("frameLength", "Slots per frame, 0 for the shortest that fits", frameLength);
+  cmd.AddValue ("pipelined", "Let frames overlap for a shorter frame", pipelined);
+  cmd.AddValue ("fixedTables", "Use compiled slot tables for the chain shapes that have them", fixedTables);
+  cmd.AddValue ("payload", "Payload size of a reading in bytes", payload);
+  cmd.AddValue ("load", "Readings per node and frame", load);
+  cmd.AddValue ("poisson", "Poisson rather than periodic readings", poisson);
+  cmd.AddValue ("theta", "Partner chance for which relays hold a lone packet a frame", theta);
+  cmd.AddValue ("errorRate", "Probability that a device loses a packet it receives", errorRate);
+  cmd.AddValue ("arq", "Retransmissions per packet and hop, 0 for no ARQ", arq);
+  cmd.AddValue ("aggregation", "Pack several readings of a flow into one frame", aggregation);
+  cmd.AddValue ("mtu", "Largest frame in bytes", mtu);
+  cmd.AddValue ("dataRate", "Radio rate the slot length follows, 0b/s for one-second slots", dataRate);
+  cmd.AddValue ("compactHeaders", "Bit-packed frame headers with a slot stamp", compactHeaders);
+  cmd.AddValue ("frames", "Number of frames in which readings are taken", frames);
+  cmd.AddValue ("drainFrames", "Frames run after the last reading, 0 for one per node", drainFrames);
+  cmd.AddValue ("seed", "Run number of the random number generator", seed);
+  cmd.AddValue ("codingMode", "Relay coding, xor or rlnc", codingMode);
+  cmd.Parse (argc, argv);
+
+  GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::CountingSimulatorImpl"));
+  RngSeedManager::SetRun (seed);
+  LwsnFrameHeader::SetFormat (compactHeaders ? LwsnFrameHeader::COMPACT : LwsnFrameHeader::COMPAT);
+
+  LinearWsnHelper wsn;
+  wsn.SetDeviceAttribute ("Theta", DoubleValue (theta));
+  wsn.SetDeviceAttribute ("ArqMaxRetransmissions", UintegerValue (arq));
+  wsn.SetDeviceAttribute ("Aggregation", BooleanValue (aggregation));
+  wsn.SetDeviceAttribute ("Mtu", UintegerValue (mtu));
+  wsn.SetDeviceAttribute ("CodingMode", EnumValue (codingMode == "rlnc" ? SimpleNetDevice::RLNC_CODING
+                                                                          : SimpleNetDevice::XOR_CODING));
+
+  // the frame length is needed for the reading interval, so build the
+  // schedule first and hand it to the helper
+  Ptr<LwsnSlotSchedule> schedule = fixedTables ? CreateFixedSchedule (nNodes, frameLength, pipelined) : 0;
+  bool fixed = schedule != 0;
+  if (!fixed)
+    {
+      schedule = CreateObject<LwsnSlotSchedule> ();
+      schedule->SetAttribute ("NNodes", UintegerValue (nNodes));
+      schedule->SetAttribute ("FrameLength", UintegerValue (frameLength));
+      schedule->SetAttribute ("Pipelined", BooleanValue (pipelined));
+    }
+  schedule->SetAttribute ("DataRate", DataRateValue (DataRate (dataRate)));
+  uint32_t f = schedule->GetFrameLength ();
+  Time start = schedule->GetSlotTime (1);
+  wsn.EnableTraffic (start, payload, Seconds (schedule->GetSlotTime (f).GetSeconds () / load), poisson);
+
+  NodeContainer nodes;
+  nodes.Create (nNodes);
+  NetDeviceContainer devices = wsn.Install (nodes, CreateObject<SimpleChannel> (), schedule);
+
+  if (errorRate > 0)
+    {
+      for (uint32_t i = 0; i < nNodes; ++i)
+        {
+          Ptr<RateErrorModel> em = CreateObject<RateErrorModel> ();
+          em->SetUnit (RateErrorModel::ERROR_UNIT_PACKET);
+          em->SetRate (errorRate);
+          devices.Get (i)->SetAttribute ("ReceiveErrorModel", PointerValue (em));
+        }
+    }
+
+  g_sent.resize (nNodes + 1);
+  g_delivered[LEFT].resize (nNodes + 1);
+  g_delivered[RIGHT].resize (nNodes + 1);
+  g_latency.resize (nNodes + 1);
+  devices.Get (0)->TraceConnectWithoutContext ("Deliver", MakeBoundCallback (&Deliver, LEFT));
+  devices.Get (nNodes - 1)->TraceConnectWithoutContext ("Deliver", MakeBoundCallback (&Deliver, RIGHT));
+  Time stopTraffic = start + schedule->GetSlotTime (frames * f);
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      Ptr<Application> app = nodes.Get (i)->GetApplication (0);
+      app->SetStopTime (stopTraffic);
+      app->TraceConnectWithoutContext ("Reading", MakeBoundCallback (&Reading, nNodes));
+    }
+
+  uint32_t runFrames = frames + (drainFrames == 0 ? nNodes : drainFrames);
+  Simulator::Stop (start + schedule->GetSlotTime (runFrames * f));
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t wallMs = clock.End ();
+
+  SimpleNetDevice::Statistics total;
+  for (uint32_t i = 0; i < nNodes; ++i)
+    {
+      const SimpleNetDevice::Statistics &s = DynamicCast<SimpleNetDevice> (devices.Get (i))->GetStatistics ();
+      total.txOriginal += s.txOriginal;
+      total.txForwarded += s.txForwarded;
+      total.txCoded += s.txCoded;
+      total.delivered += s.delivered;
+      total.deliveredBytes += s.deliveredBytes;
+      total.codingSessions += s.codingSessions;
+      total.codingHits += s.codingHits;
+      total.heldPackets += s.heldPackets;
+      total.holdSlots += s.holdSlots;
+      total.retransmitted += s.retransmitted;
+      total.retransmittedCoded += s.retransmittedCoded;
+      total.arqGiveUps += s.arqGiveUps;
+      total.acksSent += s.acksSent;
+      total.mergedFrames += s.mergedFrames;
+      total.queueDrops += s.queueDrops;
+      total.bufferDrops += s.bufferDrops;
+    }
+  uint64_t events = CountingSimulatorImpl::g_events;
+  uint64_t unique = 0;
+  for (uint32_t osid = 1; osid <= nNodes; ++osid)
+    {
+      unique += g_latency[osid].size ();
+    }
+
+  std::ostringstream os;
+  os << "{\"nNodes\":" << nNodes
+     << ",\"frameLength\":" << f
+     << ",\"fixedTables\":" << (fixed ? "true" : "false")
+     << ",\"slotSeconds\":" << schedule->GetSlotDuration ().GetSeconds ()
+     << ",\"pipelined\":" << (pipelined ? "true" : "false")
+     << ",\"compactHeaders\":" << (compactHeaders ? "true" : "false")
+     << ",\"payload\":" << payload
+     << ",\"load\":" << load
+     << ",\"poisson\":" << (poisson ? "true" : "false")
+     << ",\"errorRate\":" << errorRate
+     << ",\"theta\":" << theta
+     << ",\"arq\":" << arq
+     << ",\"aggregation\":" << (aggregation ? "true" : "false")
+     << ",\"mtu\":" << mtu
+     << ",\"frames\":" << frames
+     << ",\"seed\":" << seed
+     << ",\"codingMode\":\"" << codingMode << "\""
+     << ",\"generated\":" << g_generated
+     << ",\"delivered\":" << total.delivered
+     << ",\"unmatched\":" << g_unmatched
+     << ",\"duplicates\":" << g_duplicates
+     << ",\"deliveryRatio\":" << (g_generated ? static_cast<double> (unique) / g_generated : 0)
+     << ",\"goodputBytesPerFrame\":" << static_cast<double> (total.deliveredBytes) / runFrames
+     << ",\"txOriginal\":" << total.txOriginal
+     << ",\"txForwarded\":" << total.txForwarded
+     << ",\"txCoded\":" << total.txCoded
+     << ",\"codingHitRatio\":" << (total.codingSessions ? static_cast<double> (total.codingHits) / total.codingSessions : 0)
+     << ",\"heldPackets\":" << total.heldPackets
+     << ",\"meanHoldSlots\":" << (total.heldPackets ? static_cast<double> (total.holdSlots) / total.heldPackets : 0)
+     << ",\"retransmitted\":" << total.retransmitted
+     << ",\"retransmittedCoded\":" << total.retransmittedCoded
+     << ",\"arqGiveUps\":" << total.arqGiveUps
+     << ",\"acksSent\":" << total.acksSent
+     << ",\"mergedFrames\":" << total.mergedFrames
+     << ",\"queueDrops\":" << total.queueDrops
+     << ",\"bufferDrops\":" << total.bufferDrops
+     << ",\"events\":" << events
+     << ",\"eventsPerDelivered\":" << (total.delivered ? static_cast<double> (events) / total.delivered : 0)
+     << ",\"wallMs\":" << wallMs
+     << ",\"eventsPerSecond\":" << (wallMs ? events * 1000.0 / wallMs : 0)
+     << ",\"poolHits\":" << LwsnPacketPool::Get ().GetHits ()
+     << ",\"poolMisses\":" << LwsnPacketPool::Get ().GetMisses ()
+     << ",\"latency\":[";
+  for (uint32_t osid = 1; osid <= nNodes; ++osid)
+    {
+      std::vector<double> &l = g_latency[osid];
+      std::sort (l.begin (), l.end ());
+      os << (osid == 1 ? "" : ",")
+         << "{\"osid\":" << osid
+         << ",\"n\":" << l.size ()
+         << ",\"p50\":" << Percentile (l, 0.5)
+         << ",\"p90\":" << Percentile (l, 0.9)
+         << ",\"p99\":" << Percentile (l, 0.99)
+         << ",\"max\":" << (l.empty () ? 0 : l.back ())
+         << "}";
+    }
+  os << "]}";
+  std::cout << os.str () << std::endl;
+
+  Simulator::Destroy ();
+  return 0;
+}
@@ -0,0 +1,305 @@
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/lwsn-slot-schedule.h"
+#include "ns3/lwsn-fixed-slot-schedule.h"
+#include "ns3/lwsn-coding.h"
+#include "ns3/lwsn-rlnc.h"
+#include "ns3/lwsn-coding-buffer.h"
+#include "ns3/lwsn-frame-header.h"
+#include "ns3/lwsn-aggregate-header.h"
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <sstream>
+#include <vector>
+
+using namespace ns3;
+
+// Behavior checks of the linear WSN building blocks.
+//
+//   ./lwsn-check
+//
+// Runs without a simulation and prints one line per failed check; the
+// exit status is the number of failures, so a script can gate on it.
+// Covered are the generated default slot table against the delays of
+// the hand-written 13-slot scheme, the compiled tables of every
+// LwsnFixedSlotSchedule shape against the runtime generator, XOR and
+// RLNC coding on the kernels picked for the CPU and on the portable
+// ones, the coding buffer, the aggregate header and both wire formats
+// of the frame header.
+
+namespace {
+
+uint32_t g_failures = 0;
+
+void
+Check (bool ok, const std::string &what)
+{
+  if (!ok)
+    {
+      std::cout << "FAIL " << what << std::endl;
+      ++g_failures;
+    }
+}
+
+std::string
+Name (const char *what, uint32_t a, uint32_t b)
+{
+  std::ostringstream os;
+  os << what << " " << a << " " << b;
+  return os.str ();
+}
+
+void
+FillRandom (std::vector<uint8_t> &buffer, Ptr<UniformRandomVariable> rng)
+{
+  for (uint32_t i = 0; i < buffer.size (); ++i)
+    {
+      buffer[i] = rng->GetInteger (0, 255);
+    }
+}
+
+/**
+ * Slots from receiving each relayed flow to sending it on, in the
+ * hand-written 6-node, 13-slot scheme.  Coded flows wait for the slot of
+ * their partner's timer: at sid 3 the flow of sid 5 arrives in slot 6
+ * and goes out with the flow of sid 1 in slot 7.
+ */
+struct BaselineDelay
+{
+  uint16_t sid;
+  uint16_t osid;
+  uint16_t delay;
+};
+
+const BaselineDelay g_baseline[] = {
+  { 2, 1, 3 }, { 2, 3, 1 }, { 2, 4, 6 }, { 2, 5, 5 }, { 2, 6, 4 },
+  { 3, 1, 3 }, { 3, 2, 3 }, { 3, 4, 4 }, { 3, 5, 1 }, { 3, 6, 1 },
+  { 4, 1, 3 }, { 4, 2, 3 }, { 4, 3, 3 }, { 4, 5, 4 }, { 4, 6, 4 },
+  { 5, 1, 3 }, { 5, 2, 4 }, { 5, 3, 5 }, { 5, 4, 3 }, { 5, 6, 1 },
+};
+
+void
+CheckBaselineSchedule (void)
+{
+  Ptr<LwsnSlotSchedule> schedule = CreateObject<LwsnSlotSchedule> ();
+  Check (schedule->GetFrameLength () == 13, "default frame length");
+  for (uint32_t i = 0; i < sizeof (g_baseline) / sizeof (g_baseline[0]); ++i)
+    {
+      const BaselineDelay &b = g_baseline[i];
+      LwsnSlotSchedule::Direction dir = LwsnSlotSchedule::GetDirection (b.sid, b.osid);
+      uint16_t prev = dir == LwsnSlotSchedule::LEFT ? b.sid + 1 : b.sid - 1;
+      uint16_t received = prev == b.osid ? schedule->GetOriginalSlot (b.osid)
+        : schedule->Lookup (prev, b.osid, dir).slot;
+      const LwsnSlotSchedule::Entry &e = schedule->GetRoute (b.sid, b.osid);
+      Check (e.action != LwsnSlotSchedule::NONE, Name ("baseline route", b.sid, b.osid));
+      Check (schedule->GetWait (e.slot, received) == b.delay, Name ("baseline delay", b.sid, b.osid));
+      Check (schedule->GetDelay (b.sid, b.osid, received) == b.delay, Name ("baseline GetDelay", b.sid, b.osid));
+    }
+}
+
+/**
+ * Compare every route and delay of a schedule with compiled tables
+ * against a plain schedule of the same shape, which computes them.
+ */
+void
+CheckFixedSchedule (Ptr<LwsnSlotSchedule> fixed)
+{
+  uint16_t n = fixed->GetNNodes ();
+  uint16_t f = fixed->GetFrameLength ();
+  Ptr<LwsnSlotSchedule> runtime = CreateObject<LwsnSlotSchedule> ();
+  runtime->SetAttribute ("NNodes", UintegerValue (n));
+  runtime->SetAttribute ("FrameLength", UintegerValue (f));
+  uint32_t wrong = 0;
+  for (uint16_t sid = 1; sid <= n; ++sid)
+    {
+      for (uint16_t osid = 1; osid <= n; ++osid)
+        {
+          const LwsnSlotSchedule::Entry &a = fixed->GetRoute (sid, osid);
+          const LwsnSlotSchedule::Entry &b = runtime->GetRoute (sid, osid);
+          wrong += a.slot != b.slot || a.action != b.action || a.leader != b.leader
+            || a.partnerOsid != b.partnerOsid || a.partnerDir != b.partnerDir;
+          // two frames, so that the clock wraps
+          for (uint64_t now = 0; now < 2u * f; ++now)
+            {
+              wrong += fixed->GetDelay (sid, osid, now) != runtime->GetDelay (sid, osid, now);
+            }
+        }
+    }
+  Check (wrong == 0, Name ("fixed tables", n, f));
+}
+
+void
+CheckXor (Ptr<UniformRandomVariable> rng)
+{
+  // odd lengths and offsets reach the tails of the vector kernels
+  for (uint32_t len = 0; len < 300; len += 7)
+    {
+      for (uint32_t offset = 0; offset < 3; ++offset)
+        {
+          std::vector<uint8_t> a (len + offset), b (len + offset);
+          FillRandom (a, rng);
+          FillRandom (b, rng);
+          std::vector<uint8_t> fast (a), scalar (a);
+          LwsnCoding::SetScalarKernels (false);
+          LwsnCoding::Xor (&fast[offset], &b[offset], len);
+          LwsnCoding::SetScalarKernels (true);
+          LwsnCoding::Xor (&scalar[offset], &b[offset], len);
+          Check (fast == scalar, Name ("xor kernels agree", len, offset));
+          LwsnCoding::Xor (&scalar[offset], &b[offset], len);
+          Check (scalar == a, Name ("xor round trip", len, offset));
+        }
+    }
+  LwsnCoding::SetScalarKernels (false);
+}
+
+void
+CheckRlnc (Ptr<UniformRandomVariable> rng, bool scalar)
+{
+  LwsnCoding::SetScalarKernels (scalar);
+  const uint8_t k = 8;
+  const uint32_t size = 61;
+  std::vector<std::vector<uint8_t> > sources (k, std::vector<uint8_t> (size));
+  LwsnRlncGeneration source (k, size);
+  for (uint8_t i = 0; i < k; ++i)
+    {
+      FillRandom (sources[i], rng);
+      source.AddSource (i, &sources[i][0]);
+    }
+
+  // the sink decodes from recoded combinations only
+  LwsnRlncGeneration sink (k, size);
+  std::vector<uint8_t> random (k), coeffs (k), symbol (size);
+  for (uint32_t tries = 0; tries < 4 * k && !sink.IsComplete (); ++tries)
+    {
+      FillRandom (random, rng);
+      source.Recode (&random[0], &coeffs[0], &symbol[0]);
+      sink.Add (&coeffs[0], &symbol[0]);
+    }
+  Check (sink.IsComplete (), Name ("rlnc complete", scalar, k));
+  for (uint8_t i = 0; i < k && sink.IsComplete (); ++i)
+    {
+      Check (std::memcmp (sink.GetSymbol (i), &sources[i][0], size) == 0, Name ("rlnc symbol", scalar, i));
+    }
+
+  // a product agrees with the multiplication table on every kernel
+  std::vector<uint8_t> dst (size, 0);
+  for (uint32_t c = 0; c < 256; ++c)
+    {
+      std::fill (dst.begin (), dst.end (), 0);
+      LwsnCoding::GfMulAdd (&dst[0], &sources[0][0], c, size);
+      bool ok = true;
+      for (uint32_t i = 0; i < size; ++i)
+        {
+          ok = ok && dst[i] == LwsnCoding::GfMul (c, sources[0][i]);
+        }
+      Check (ok, Name ("gf multiply-add", scalar, c));
+    }
+  LwsnCoding::SetScalarKernels (false);
+}
+
+void
+CheckCodingBuffer (void)
+{
+  LwsnCodingBuffer buffer (2, 1);
+  Ptr<Packet> p1 = Create<Packet> (10);
+  Ptr<Packet> p2 = Create<Packet> (11);
+  Ptr<Packet> p3 = Create<Packet> (12);
+  buffer.Insert (4, 1, p1, 0);
+  buffer.Insert (4, 2, p2, 0);
+  Check (buffer.Find (4, 1, 0) == p1 && buffer.Find (4, 2, 0) == p2, "buffer find by sequence");
+  Check (buffer.Find (5, 1, 0) == 0, "buffer other origin");
+  buffer.Insert (4, 3, p3, 1);
+  Check (buffer.Find (4, 1, 1) == 0 && buffer.Find (4, 3, 1) == p3, "buffer evicts the oldest");
+  Check (buffer.Remove (4, 2, 1) == p2 && buffer.Find (4, 2, 1) == 0, "buffer remove");
+  Check (buffer.Find (4, 3, 3) == 0 && buffer.GetNPackets () == 0, "buffer expiry");
+}
+
+void
+CheckAggregateHeader (void)
+{
+  LwsnAggregateHeader readings;
+  for (uint32_t i = 0; i < 5; ++i)
+    {
+      readings.AddReading (1000 + i, 20 + i);
+    }
+  Check (readings.GetSerializedSize () == LwsnAggregateHeader::GetHeaderSize (5), "aggregate size");
+  Ptr<Packet> p = Create<Packet> (110);
+  p->AddHeader (readings);
+  LwsnAggregateHeader copy;
+  p->RemoveHeader (copy);
+  Check (copy.GetNReadings () == 5 && p->GetSize () == 110, "aggregate round trip");
+  for (uint8_t i = 0; i < copy.GetNReadings (); ++i)
+    {
+      Check (copy.GetSequence (i) == 1000u + i && copy.GetSize (i) == 20u + i, Name ("aggregate reading", i, 0));
+    }
+}
+
+void
+CheckFrameHeader (LwsnFrameHeader::Format format)
+{
+  LwsnFrameHeader::SetFormat (format);
+  LwsnFrameHeader header;
+  header.SetType (LwsnHeader::NETWORK_CODING);
+  header.SetOsid (4095);
+  header.SetOsid2 (17);
+  header.SetPsid (2048);
+  header.SetE (1);
+  header.SetR (0.5);
+  header.SetSlot ((1 << 20) + 12345);
+  Ptr<Packet> p = Create<Packet> (30);
+  p->AddHeader (header);
+  Check (p->GetSize () == 30 + header.GetSerializedSize (), Name ("frame header size", format, 0));
+  LwsnFrameHeader copy;
+  uint32_t read = p->RemoveHeader (copy);
+  Check (read == header.GetSerializedSize () && p->GetSize () == 30, Name ("frame header length", format, 0));
+  Check (copy.GetType () == LwsnHeader::NETWORK_CODING && copy.GetOsid () == 4095
+         && copy.GetOsid2 () == 17 && copy.GetPsid () == 2048 && copy.GetE () == 1,
+         Name ("frame header fields", format, 0));
+  if (format == LwsnFrameHeader::COMPACT)
+    {
+      Check (copy.GetSlot () == 12345, "frame header slot");
+    }
+  else
+    {
+      Check (copy.GetR () == 0.5 && copy.GetSlot () == 0, "frame header R");
+    }
+
+  // a frame of one flow leaves Osid2 out of the compact format
+  LwsnFrameHeader single;
+  single.SetType (LwsnHeader::FORWARDING);
+  single.SetOsid (9);
+  single.SetPsid (10);
+  p->AddHeader (single);
+  p->RemoveHeader (copy);
+  Check (copy.GetType () == LwsnHeader::FORWARDING && copy.GetOsid () == 9 && copy.GetPsid () == 10
+         && (format == LwsnFrameHeader::COMPAT || copy.GetOsid2 () == 0),
+         Name ("frame header forwarding", format, 0));
+}
+
+} // anonymous namespace
+
+int main (int argc, char *argv[])
+{
+  CommandLine cmd;
+  cmd.Parse (argc, argv);
+
+  Ptr<UniformRandomVariable> rng = CreateObject<UniformRandomVariable> ();
+  CheckBaselineSchedule ();
+  CheckFixedSchedule (LwsnFixedSlotSchedule<6, 13, 3>::Create ());
+  CheckFixedSchedule (LwsnFixedSlotSchedule<8, 22, 3>::Create ());
+  CheckFixedSchedule (LwsnFixedSlotSchedule<12, 38, 3>::Create ());
+  CheckXor (rng);
+  CheckRlnc (rng, false);
+  CheckRlnc (rng, true);
+  CheckCodingBuffer ();
+  CheckAggregateHeader ();
+  LwsnFrameHeader::Format format = LwsnFrameHeader::GetFormat ();
+  CheckFrameHeader (LwsnFrameHeader::COMPAT);
+  CheckFrameHeader (LwsnFrameHeader::COMPACT);
+  LwsnFrameHeader::SetFormat (format);
+
+  std::cout << (g_failures == 0 ? "PASS" : "FAILED") << " xor=" << LwsnCoding::GetXorKernelName ()
+            << " gf=" << LwsnCoding::GetGfKernelName () << std::endl;
+  return g_failures;
+}
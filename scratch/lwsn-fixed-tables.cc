@@ -0,0 +1,198 @@
+#include "ns3/core-module.h"
+#include "ns3/lwsn-slot-schedule.h"
+#include <fstream>
+#include <iostream>
+#include <sstream>
+
+using namespace ns3;
+
+// Generate the compiled slot tables of LwsnFixedSlotSchedule.
+//
+//   ./lwsn-fixed-tables --output=utils/lwsn-fixed-slot-tables
+//
+// Writes <output>.h and <output>.cc with one LwsnFixedSlotTables
+// specialization per shape in g_shapes, holding the routes and delays
+// that the runtime generator of LwsnSlotSchedule computes for it.  Run
+// it again after a change to the generator or to g_shapes; lwsn-check
+// compares the compiled tables against the runtime generator.
+
+namespace {
+
+/// A chain shape the tables are compiled for.
+struct Shape
+{
+  uint16_t nNodes;
+  uint16_t frameLength;
+  uint16_t reuse;
+  bool pipelined;
+};
+
+/**
+ * The supported shapes: the 13-slot chain the scheme was designed for
+ * and the shortest unpipelined frames of 8 and 12 sids.
+ */
+const Shape g_shapes[] = {
+  { 6, 13, 3, false },
+  { 8, 22, 3, false },
+  { 12, 38, 3, false },
+};
+
+const char *g_license =
+  "/* -*- Mode:C++; c-file-style:\"gnu\"; indent-tabs-mode:nil; -*- */\n"
+  "/*\n"
+  " * This program is free software; you can redistribute it and/or modify\n"
+  " * it under the terms of the GNU General Public License version 2 as\n"
+  " * published by the Free Software Foundation;\n"
+  " *\n"
+  " * This program is distributed in the hope that it will be useful,\n"
+  " * but WITHOUT ANY WARRANTY; without even the implied warranty of\n"
+  " * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the\n"
+  " * GNU General Public License for more details.\n"
+  " *\n"
+  " * You should have received a copy of the GNU General Public License\n"
+  " * along with this program; if not, write to the Free Software\n"
+  " * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA\n"
+  " */\n"
+  "\n"
+  "// Generated by scratch/lwsn-fixed-tables.cc; do not edit.\n"
+  "\n";
+
+std::string
+Name (const Shape &s)
+{
+  std::ostringstream os;
+  os << "LwsnFixedSlotTables<" << s.nNodes << ", " << s.frameLength << ", " << s.reuse << ", "
+     << (s.pipelined ? "true" : "false") << ">";
+  return os.str ();
+}
+
+void
+WriteHeader (std::ostream &os)
+{
+  os << g_license
+     << "#ifndef LWSN_FIXED_SLOT_TABLES_H\n"
+     << "#define LWSN_FIXED_SLOT_TABLES_H\n"
+     << "\n"
+     << "#include <stdint.h>\n"
+     << "\n"
+     << "#include \"lwsn-slot-schedule.h\"\n"
+     << "\n"
+     << "namespace ns3 {\n"
+     << "\n"
+     << "/**\n"
+     << " * \\ingroup netdevice\n"
+     << " *\n"
+     << " * \\brief Routes and delays of LwsnFixedSlotSchedule for one chain shape.\n"
+     << " *\n"
+     << " * Only the shapes specialized below exist; any other shape fails to\n"
+     << " * compile.  routes has (NNodes + 1)^2 entries, indexed\n"
+     << " * sid * (NNodes + 1) + osid, and delays FrameLength entries for each of\n"
+     << " * those, by slot of the frame.\n"
+     << " *\n"
+     << " * \\tparam NNodes number of sids in the chain\n"
+     << " * \\tparam FrameLength slots per frame\n"
+     << " * \\tparam ReuseDistance hops between two transmitters of one slot\n"
+     << " * \\tparam Pipelined value of the Pipelined attribute\n"
+     << " */\n"
+     << "template <uint16_t NNodes, uint16_t FrameLength, uint16_t ReuseDistance, bool Pipelined>\n"
+     << "struct LwsnFixedSlotTables;\n";
+  for (uint32_t i = 0; i < sizeof (g_shapes) / sizeof (g_shapes[0]); ++i)
+    {
+      const Shape &s = g_shapes[i];
+      uint32_t pairs = (s.nNodes + 1) * (s.nNodes + 1);
+      os << "\n"
+         << "/// Tables of " << s.nNodes << " sids, " << s.frameLength << " slots, reuse distance "
+         << s.reuse << (s.pipelined ? ", pipelined" : "") << ".\n"
+         << "template <>\n"
+         << "struct " << Name (s) << "\n"
+         << "{\n"
+         << "  static const LwsnSlotSchedule::Entry routes[" << pairs << "]; //!< route per (sid, osid)\n"
+         << "  static const uint16_t delays[" << pairs * s.frameLength << "]; //!< delay per (sid, osid, slot)\n"
+         << "};\n";
+    }
+  os << "\n"
+     << "} // namespace ns3\n"
+     << "\n"
+     << "#endif /* LWSN_FIXED_SLOT_TABLES_H */\n";
+}
+
+void
+WriteSource (std::ostream &os)
+{
+  os << g_license
+     << "#include \"lwsn-fixed-slot-tables.h\"\n"
+     << "\n"
+     << "namespace ns3 {\n";
+  for (uint32_t i = 0; i < sizeof (g_shapes) / sizeof (g_shapes[0]); ++i)
+    {
+      const Shape &s = g_shapes[i];
+      const uint16_t n = s.nNodes;
+      Ptr<LwsnSlotSchedule> schedule = CreateObject<LwsnSlotSchedule> ();
+      schedule->SetAttribute ("NNodes", UintegerValue (n));
+      schedule->SetAttribute ("FrameLength", UintegerValue (s.frameLength));
+      schedule->SetAttribute ("ReuseDistance", UintegerValue (s.reuse));
+      schedule->SetAttribute ("Pipelined", BooleanValue (s.pipelined));
+      NS_ABORT_MSG_IF (schedule->GetFrameLength () != s.frameLength, Name (s) << " has the wrong frame length");
+
+      // row 0 and column 0 are padding, sids start at 1
+      os << "\n"
+         << "const LwsnSlotSchedule::Entry " << Name (s) << "::routes[" << (n + 1) * (n + 1) << "] = {\n";
+      for (uint16_t sid = 0; sid <= n; ++sid)
+        {
+          os << "  // sid " << sid << "\n";
+          for (uint16_t osid = 0; osid <= n; ++osid)
+            {
+              LwsnSlotSchedule::Entry e = { 0, 0, 0, 0, 0 };
+              if (sid != 0 && osid != 0)
+                {
+                  e = schedule->GetRoute (sid, osid);
+                }
+              os << (osid % 4 == 0 ? "  " : " ") << "{ " << e.slot << ", " << (uint32_t)e.action << ", "
+                 << (uint32_t)e.leader << ", " << e.partnerOsid << ", " << (uint32_t)e.partnerDir << " },"
+                 << (osid % 4 == 3 || osid == n ? "\n" : "");
+            }
+        }
+      os << "};\n";
+
+      os << "\n"
+         << "const uint16_t " << Name (s) << "::delays[" << (n + 1) * (n + 1) * s.frameLength << "] = {\n";
+      for (uint16_t sid = 0; sid <= n; ++sid)
+        {
+          for (uint16_t osid = 0; osid <= n; ++osid)
+            {
+              os << "  // sid " << sid << ", osid " << osid << "\n";
+              for (uint16_t now = 0; now < s.frameLength; ++now)
+                {
+                  uint16_t delay = sid != 0 && osid != 0 ? schedule->GetDelay (sid, osid, now) : 0;
+                  os << (now % 16 == 0 ? "  " : " ") << delay << ","
+                     << (now % 16 == 15 || now + 1 == s.frameLength ? "\n" : "");
+                }
+            }
+        }
+      os << "};\n";
+    }
+  os << "\n"
+     << "} // namespace ns3\n";
+}
+
+} // anonymous namespace
+
+int main (int argc, char *argv[])
+{
+  std::string output = "lwsn-fixed-slot-tables";
+
+  CommandLine cmd;
+  cmd.AddValue ("output", "Path of the generated files, without .h or .cc", output);
+  cmd.Parse (argc, argv);
+
+  std::ofstream header ((output + ".h").c_str ());
+  std::ofstream source ((output + ".cc").c_str ());
+  if (!header || !source)
+    {
+      std::cerr << output << ": cannot write the tables" << std::endl;
+      return 1;
+    }
+  WriteHeader (header);
+  WriteSource (source);
+  return 0;
+}
@@ -0,0 +1,206 @@
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/mpi-interface.h"
+#include "ns3/mpi-receiver.h"
+#include "ns3/distributed-simulator-impl.h"
+#include "ns3/linear-wsn-helper.h"
+#include <iomanip>
+#include <iostream>
+#include <map>
+#include <sstream>
+
+using namespace ns3;
+
+// Partitioned run of a long chain.
+//
+//   mpirun -np K ./lwsn-parallel --nNodes=5000
+//
+// Sids are 16 bits, so a chain has at most 65535 nodes, and an
+// unpipelined frame fits some 8800 of them.  Rank r only builds the r-th
+// contiguous segment of the chain and a stub for each neighbor across
+// its boundaries.  Packets that cross a segment boundary travel as MPI
+// messages and arrive one channel delay after they were sent; with a
+// delay below one slot that delay is the lookahead of the ranks, so they
+// only synchronize about once per slot.  Every rank prints one JSON line
+// with the counters of its own devices; summed over the ranks they equal
+// the line printed by a run with -np 1 and the same delay.  They differ
+// from the sequential benchmark, whose channel has no delay: there a
+// frame arrives in the slot it is sent in, here in the middle of it.
+//
+// With --flows the ranks also print a line per flow a local sink
+// delivered: sink sid, origin sid, readings, and the sum of their
+// latencies.  Events of one time stamp may be handled in another order
+// across ranks, so compare the sorted lines:
+//
+//   mpirun -np 1 ./lwsn-parallel --flows=1 | grep ^flow | sort > seq.txt
+//   mpirun -np 4 ./lwsn-parallel --flows=1 | grep ^flow | sort > par.txt
+//   diff seq.txt par.txt
+//
+// The two agree for any number of ranks as long as nNodes, frameLength,
+// delay and the other options are the same.
+
+namespace {
+
+uint32_t g_nNodes;              //!< nodes in the chain
+uint32_t g_firstNode;           //!< id of the first node the helper made
+const LinearWsnHelper *g_wsn;   //!< helper that made the chain
+Time g_firstReading;            //!< time of the first reading of every node
+Time g_frame;                   //!< time between two readings of a node
+
+/// Readings and summed latency in seconds of one flow at one sink.
+struct Flow
+{
+  Flow ()
+    : delivered (0),
+      latency (0)
+  {
+  }
+  uint64_t delivered;
+  double latency;
+};
+
+/// Flows per sink sid and origin sid.
+std::map<std::pair<uint16_t, uint16_t>, Flow> g_flows;
+
+void
+Deliver (uint16_t sink, uint16_t osid, uint32_t seq, uint32_t size)
+{
+  // readings are taken once per frame from the first one on, on every
+  // rank alike, so the sink knows when each was taken
+  Flow &flow = g_flows[std::make_pair (sink, osid)];
+  ++flow.delivered;
+  flow.latency += (Simulator::Now () - g_firstReading).GetSeconds () - g_frame.GetSeconds () * seq;
+}
+
+void
+SendRemote (Ptr<Packet> p, Time rxTime, Ptr<SimpleNetDevice> device)
+{
+  // device is a stub; address the node on the rank that simulates it
+  uint32_t i = device->GetSid () - 1;
+  uint32_t node = g_firstNode + i - g_wsn->GetSegmentStart (g_nNodes, g_wsn->GetPartition (g_nNodes, i));
+  MpiInterface::SendPacket (p, rxTime, node, device->GetIfIndex ());
+}
+
+} // anonymous namespace
+
+int main (int argc, char *argv[])
+{
+  uint32_t nNodes = 6;
+  uint32_t frameLength = 0;
+  uint32_t frames = 10;
+  uint32_t payload = 100;
+  double delay = 0.5;
+  std::string dataRate = "0b/s";
+  bool flows = false;
+
+  CommandLine cmd;
+  cmd.AddValue ("nNodes", "Number of nodes in the chain", nNodes);
+  cmd.AddValue ("frameLength", "Slots per frame, 0 for the shortest that fits", frameLength);
+  cmd.AddValue ("frames", "Number of frames to simulate", frames);
+  cmd.AddValue ("payload", "Payload size of a reading in bytes", payload);
+  cmd.AddValue ("delay", "Channel delay in slots, the lookahead of the ranks; below one", delay);
+  cmd.AddValue ("dataRate", "Radio rate the slot length follows, 0b/s for one-second slots", dataRate);
+  cmd.AddValue ("flows", "Also print the deliveries and latency of every flow at the local sinks", flows);
+  cmd.Parse (argc, argv);
+  NS_ABORT_MSG_IF (delay <= 0 || delay >= 1, "delay must lie strictly between 0 and one slot");
+
+  GlobalValue::Bind ("SimulatorImplementationType", StringValue ("ns3::DistributedSimulatorImpl"));
+  MpiInterface::Enable (&argc, &argv);
+  uint32_t rank = MpiInterface::GetSystemId ();
+  uint32_t ranks = MpiInterface::GetSize ();
+
+  // the slot length is needed for the delay before the chain is built
+  Ptr<LwsnSlotSchedule> timing = CreateObject<LwsnSlotSchedule> ();
+  timing->SetAttribute ("DataRate", DataRateValue (DataRate (dataRate)));
+  Time slot = timing->GetSlotDuration ();
+  Time lookahead = Seconds (slot.GetSeconds () * delay);
+
+  LinearWsnHelper wsn;
+  wsn.SetScheduleAttribute ("FrameLength", UintegerValue (frameLength));
+  wsn.SetScheduleAttribute ("DataRate", DataRateValue (DataRate (dataRate)));
+  wsn.SetChannelAttribute ("Delay", TimeValue (lookahead));
+  wsn.SetPartitions (ranks);
+  wsn.EnableTraffic (slot, payload);
+
+  NodeContainer nodes;
+  NetDeviceContainer devices = wsn.Create (nNodes, nodes);
+  Ptr<SimpleNetDevice> first = DynamicCast<SimpleNetDevice> (devices.Get (0));
+  g_nNodes = nNodes;
+  g_firstNode = nodes.Get (rank == 0 ? 0 : 1)->GetId ();
+  g_wsn = &wsn;
+  DynamicCast<SimpleChannel> (first->GetChannel ())->SetRemoteCallback (MakeCallback (&SendRemote));
+  for (uint32_t i = 0; i < devices.GetN (); ++i)
+    {
+      Ptr<SimpleNetDevice> device = DynamicCast<SimpleNetDevice> (devices.Get (i));
+      if (device->IsLocal ())
+        {
+          Ptr<MpiReceiver> receiver = CreateObject<MpiReceiver> ();
+          receiver->SetReceiveCallback (MakeCallback (&SimpleNetDevice::ReceiveRemote, device));
+          device->AggregateObject (receiver);
+        }
+    }
+  // the lookahead is not derived from point-to-point links here
+  DynamicCast<DistributedSimulatorImpl> (Simulator::GetImplementation ())->BoundLookAhead (lookahead);
+
+  Ptr<LwsnSlotSchedule> schedule = first->GetSlotSchedule ();
+  g_firstReading = slot;
+  g_frame = schedule->GetSlotTime (schedule->GetFrameLength ());
+  for (uint32_t i = 0; i < devices.GetN () && flows; ++i)
+    {
+      Ptr<SimpleNetDevice> device = DynamicCast<SimpleNetDevice> (devices.Get (i));
+      if (device->IsLocal () && (device->GetSid () == 1 || device->GetSid () == nNodes))
+        {
+          device->TraceConnectWithoutContext ("Deliver", MakeBoundCallback (&Deliver, device->GetSid ()));
+        }
+    }
+  Simulator::Stop (slot + schedule->GetSlotTime (schedule->GetFrameLength () * frames));
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t wallMs = clock.End ();
+
+  SimpleNetDevice::Statistics total;
+  double energy = 0;
+  uint32_t local = 0;
+  for (uint32_t i = 0; i < devices.GetN (); ++i)
+    {
+      Ptr<SimpleNetDevice> device = DynamicCast<SimpleNetDevice> (devices.Get (i));
+      if (!device->IsLocal ())
+        {
+          continue;
+        }
+      const SimpleNetDevice::Statistics &s = device->GetStatistics ();
+      total.txOriginal += s.txOriginal;
+      total.txForwarded += s.txForwarded;
+      total.txCoded += s.txCoded;
+      total.delivered += s.delivered;
+      total.deliveredBytes += s.deliveredBytes;
+      energy += device->GetTotalEnergy ();
+      ++local;
+    }
+
+  std::ostringstream os;
+  os << std::setprecision (17)
+     << "{\"rank\":" << rank
+     << ",\"ranks\":" << ranks
+     << ",\"nodes\":" << local
+     << ",\"txOriginal\":" << total.txOriginal
+     << ",\"txForwarded\":" << total.txForwarded
+     << ",\"txCoded\":" << total.txCoded
+     << ",\"delivered\":" << total.delivered
+     << ",\"deliveredBytes\":" << total.deliveredBytes
+     << ",\"energy\":" << energy
+     << ",\"wallMs\":" << wallMs
+     << "}";
+  std::cout << os.str () << std::endl;
+  for (std::map<std::pair<uint16_t, uint16_t>, Flow>::const_iterator it = g_flows.begin ();
+       it != g_flows.end (); ++it)
+    {
+      std::cout << std::setprecision (17) << "flow " << it->first.first << " " << it->first.second
+                << " " << it->second.delivered << " " << it->second.latency << std::endl;
+    }
+
+  Simulator::Destroy ();
+  MpiInterface::Disable ();
+  return 0;
+}
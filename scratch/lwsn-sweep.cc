@@ -0,0 +1,319 @@
+#ifndef _GNU_SOURCE
+#define _GNU_SOURCE
+#endif
+#include <sched.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Parameter sweep over chain scenarios.
+//
+// usage: lwsn-sweep [--jobs=J] [--runs=R] [--seed=S] [--out=FILE]
+//                   PROGRAM [name=v1,v2,... ...]
+//
+// Every combination of the listed parameter values is a configuration;
+// each configuration is run R times.  A run executes
+//
+//   PROGRAM --name=value ... --seed=<S + replication>
+//
+// in a worker process pinned to its own core, at most J at a time (one
+// per core this process may use by default).  Replication r of every configuration
+// uses run number S + r, so configurations are compared on the same
+// random numbers and a sweep is reproducible whatever J is.
+//
+// PROGRAM is expected to print one line, such as the JSON object of
+// lwsn-benchmark.  The lines of all runs are merged in run order, each
+// prefixed with its configuration and replication index, into FILE or
+// stdout.  Failed runs are reported on stderr and leave an error line.
+
+namespace {
+
+/// One parameter of the grid and its values.
+struct Axis
+{
+  std::string name;
+  std::vector<std::string> values;
+};
+
+/// One worker process.
+struct Run
+{
+  uint32_t config;          //!< configuration index
+  uint32_t replication;     //!< replication index
+  std::vector<std::string> args; //!< command line
+  std::string output;       //!< file the worker writes its stdout to
+  pid_t pid;                //!< worker process, 0 if not started
+  int cpu;                  //!< core the worker is pinned to
+  int status;               //!< wait status of the finished worker
+};
+
+std::vector<std::string>
+Split (const std::string &s, char sep)
+{
+  std::vector<std::string> parts;
+  std::istringstream is (s);
+  std::string part;
+  while (std::getline (is, part, sep))
+    {
+      parts.push_back (part);
+    }
+  return parts;
+}
+
+bool
+ParseOption (const char *arg, const char *name, std::string &value)
+{
+  size_t len = std::strlen (name);
+  if (std::strncmp (arg, name, len) != 0 || arg[len] != '=')
+    {
+      return false;
+    }
+  value = arg + len + 1;
+  return true;
+}
+
+void
+Start (Run &run, int cpu)
+{
+  char path[] = "/tmp/lwsn-sweep-XXXXXX";
+  int fd = mkstemp (path);
+  if (fd < 0)
+    {
+      std::perror ("mkstemp");
+      std::exit (1);
+    }
+  run.output = path;
+  run.cpu = cpu;
+  run.pid = fork ();
+  if (run.pid < 0)
+    {
+      std::perror ("fork");
+      std::exit (1);
+    }
+  if (run.pid == 0)
+    {
+      cpu_set_t set;
+      CPU_ZERO (&set);
+      CPU_SET (cpu, &set);
+      sched_setaffinity (0, sizeof (set), &set);
+      dup2 (fd, STDOUT_FILENO);
+      close (fd);
+      std::vector<char *> argv;
+      for (size_t i = 0; i < run.args.size (); ++i)
+        {
+          argv.push_back (const_cast<char *> (run.args[i].c_str ()));
+        }
+      argv.push_back (0);
+      execvp (argv[0], &argv[0]);
+      std::perror (argv[0]);
+      _exit (127);
+    }
+  close (fd);
+}
+
+/**
+ * \returns the cores this process may run on
+ */
+std::vector<int>
+GetCpus (void)
+{
+  std::vector<int> cpus;
+  cpu_set_t set;
+  if (sched_getaffinity (0, sizeof (set), &set) == 0)
+    {
+      for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu)
+        {
+          if (CPU_ISSET (cpu, &set))
+            {
+              cpus.push_back (cpu);
+            }
+        }
+    }
+  if (cpus.empty ())
+    {
+      cpus.push_back (0);
+    }
+  return cpus;
+}
+
+} // anonymous namespace
+
+int main (int argc, char *argv[])
+{
+  std::vector<int> cpus = GetCpus ();
+  uint32_t jobs = cpus.size ();
+  uint32_t runs = 1;
+  uint32_t seed = 1;
+  std::string out;
+  std::string program;
+  std::vector<Axis> grid;
+
+  for (int i = 1; i < argc; ++i)
+    {
+      std::string value;
+      if (program.empty () && ParseOption (argv[i], "--jobs", value))
+        {
+          jobs = std::max (1, std::atoi (value.c_str ()));
+        }
+      else if (program.empty () && ParseOption (argv[i], "--runs", value))
+        {
+          runs = std::max (1, std::atoi (value.c_str ()));
+        }
+      else if (program.empty () && ParseOption (argv[i], "--seed", value))
+        {
+          seed = std::atoi (value.c_str ());
+        }
+      else if (program.empty () && ParseOption (argv[i], "--out", value))
+        {
+          out = value;
+        }
+      else if (program.empty ())
+        {
+          program = argv[i];
+        }
+      else
+        {
+          const char *eq = std::strchr (argv[i], '=');
+          if (eq == 0 || eq == argv[i])
+            {
+              std::cerr << "bad grid axis " << argv[i] << ", expected name=v1,v2,..." << std::endl;
+              return 1;
+            }
+          Axis axis;
+          axis.name = std::string (argv[i], eq - argv[i]);
+          axis.values = Split (eq + 1, ',');
+          if (axis.values.empty ())
+            {
+              std::cerr << "grid axis " << axis.name << " has no values" << std::endl;
+              return 1;
+            }
+          grid.push_back (axis);
+        }
+    }
+  if (program.empty ())
+    {
+      std::cerr << "usage: " << argv[0]
+                << " [--jobs=J] [--runs=R] [--seed=S] [--out=FILE] PROGRAM [name=v1,v2,... ...]"
+                << std::endl;
+      return 1;
+    }
+
+  // configurations in row-major order, the last axis varying fastest
+  uint32_t configs = 1;
+  for (size_t a = 0; a < grid.size (); ++a)
+    {
+      configs *= grid[a].values.size ();
+    }
+  std::vector<Run> all;
+  all.reserve (configs * runs);
+  for (uint32_t c = 0; c < configs; ++c)
+    {
+      for (uint32_t r = 0; r < runs; ++r)
+        {
+          Run run;
+          run.config = c;
+          run.replication = r;
+          run.args.push_back (program);
+          uint32_t rest = c;
+          for (size_t a = grid.size (); a-- > 0; )
+            {
+              const Axis &axis = grid[a];
+              run.args.insert (run.args.begin () + 1,
+                               "--" + axis.name + "=" + axis.values[rest % axis.values.size ()]);
+              rest /= axis.values.size ();
+            }
+          std::ostringstream os;
+          os << "--seed=" << seed + r;
+          run.args.push_back (os.str ());
+          run.pid = 0;
+          run.cpu = -1;
+          run.status = 0;
+          all.push_back (run);
+        }
+    }
+
+  // at most jobs workers at a time; worker slot i runs on the i-th
+  // allowed core, so no two workers share one unless jobs exceeds them
+  std::vector<size_t> onCpu (jobs, all.size ());
+  size_t next = 0;
+  uint32_t running = 0;
+  while (next < all.size () || running > 0)
+    {
+      while (next < all.size () && running < jobs)
+        {
+          uint32_t cpu = 0;
+          while (onCpu[cpu] != all.size ())
+            {
+              ++cpu;
+            }
+          Start (all[next], cpus[cpu % cpus.size ()]);
+          onCpu[cpu] = next;
+          ++next;
+          ++running;
+        }
+      int status;
+      pid_t pid = wait (&status);
+      if (pid < 0)
+        {
+          std::perror ("wait");
+          return 1;
+        }
+      for (uint32_t cpu = 0; cpu < jobs; ++cpu)
+        {
+          if (onCpu[cpu] != all.size () && all[onCpu[cpu]].pid == pid)
+            {
+              all[onCpu[cpu]].status = status;
+              onCpu[cpu] = all.size ();
+              --running;
+              break;
+            }
+        }
+    }
+
+  std::ofstream file;
+  if (!out.empty ())
+    {
+      file.open (out.c_str ());
+      if (!file)
+        {
+          std::cerr << "cannot write " << out << std::endl;
+          return 1;
+        }
+    }
+  std::ostream &os = out.empty () ? std::cout : file;
+  int failed = 0;
+  for (size_t i = 0; i < all.size (); ++i)
+    {
+      const Run &run = all[i];
+      std::ifstream in (run.output.c_str ());
+      std::string line;
+      bool ok = WIFEXITED (run.status) && WEXITSTATUS (run.status) == 0
+        && std::getline (in, line) && !line.empty ();
+      os << run.config << "\t" << run.replication << "\t";
+      if (ok)
+        {
+          os << line << "\n";
+        }
+      else
+        {
+          std::cerr << "run " << run.config << "." << run.replication << " failed:";
+          for (size_t a = 0; a < run.args.size (); ++a)
+            {
+              std::cerr << " " << run.args[a];
+            }
+          std::cerr << std::endl;
+          os << "{\"error\":" << run.status << "}\n";
+          ++failed;
+        }
+      std::remove (run.output.c_str ());
+    }
+  return failed ? 1 : 0;
+}
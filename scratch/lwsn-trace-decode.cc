@@ -0,0 +1,46 @@
+#include "ns3/lwsn-trace.h"
+#include <cstdlib>
+#include <iostream>
+
+using namespace ns3;
+
+// Print a binary trace written by LwsnTrace::Write, one event per line,
+// followed by the number of events of each type.
+int main (int argc, char *argv[])
+{
+  if (argc != 2)
+    {
+      std::cerr << "usage: " << argv[0] << " <trace file>" << std::endl;
+      return 1;
+    }
+
+  std::vector<LwsnTrace::Record> records;
+  uint64_t total = 0;
+  if (!LwsnTrace::Read (argv[1], records, total))
+    {
+      std::cerr << argv[1] << ": not an LWSN trace" << std::endl;
+      return 1;
+    }
+
+  uint64_t counts[LwsnTrace::EVENTS + 1] = { 0 };
+  for (size_t i = 0; i < records.size (); ++i)
+    {
+      const LwsnTrace::Record &r = records[i];
+      std::cout << r.time << " " << LwsnTrace::GetEventName (r.event)
+                << " sid=" << r.sid << " osid=" << r.osid;
+      if (r.osid2 != 0)
+        {
+          std::cout << " osid2=" << r.osid2;
+        }
+      std::cout << " size=" << r.size << "\n";
+      ++counts[r.event < LwsnTrace::EVENTS ? r.event : LwsnTrace::EVENTS];
+    }
+
+  std::cout << "# " << records.size () << " of " << total << " records";
+  for (uint8_t e = 0; e < LwsnTrace::EVENTS; ++e)
+    {
+      std::cout << " " << LwsnTrace::GetEventName (e) << "=" << counts[e];
+    }
+  std::cout << std::endl;
+  return 0;
+}
@@ -0,0 +1,220 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/simple-channel.h"
+#include "ns3/mac48-address.h"
+#include "linear-wsn-helper.h"
+#include "lwsn-sensor-application.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LinearWsnHelper");
+
+namespace {
+
+/**
+ * \return a locally administered address derived from the sid, which
+ *         every partition assigns alike
+ */
+Mac48Address
+SidAddress (uint16_t sid)
+{
+  uint8_t buffer[6] = { 0x02, 0, 0, 0, uint8_t (sid >> 8), uint8_t (sid) };
+  Mac48Address address;
+  address.CopyFrom (buffer);
+  return address;
+}
+
+} // anonymous namespace
+
+LinearWsnHelper::LinearWsnHelper ()
+  : m_trafficStart (Seconds (1.0)),
+    m_traffic (false),
+    m_partitions (1)
+{
+  m_deviceFactory.SetTypeId ("ns3::SimpleNetDevice");
+  m_channelFactory.SetTypeId ("ns3::SimpleChannel");
+  m_scheduleFactory.SetTypeId ("ns3::LwsnSlotSchedule");
+  m_scheduleFactory.Set ("FrameLength", UintegerValue (0));
+  m_trafficFactory.SetTypeId ("ns3::LwsnSensorApplication");
+}
+
+void
+LinearWsnHelper::SetDeviceAttribute (std::string n1, const AttributeValue &v1)
+{
+  m_deviceFactory.Set (n1, v1);
+}
+
+void
+LinearWsnHelper::SetChannelAttribute (std::string n1, const AttributeValue &v1)
+{
+  m_channelFactory.Set (n1, v1);
+}
+
+void
+LinearWsnHelper::SetScheduleAttribute (std::string n1, const AttributeValue &v1)
+{
+  m_scheduleFactory.Set (n1, v1);
+}
+
+void
+LinearWsnHelper::SetTrafficAttribute (std::string n1, const AttributeValue &v1)
+{
+  m_trafficFactory.Set (n1, v1);
+}
+
+void
+LinearWsnHelper::EnableTraffic (Time start, uint32_t size, Time period, bool poisson)
+{
+  m_trafficStart = start;
+  m_trafficFactory.Set ("PayloadSize", UintegerValue (size));
+  m_trafficFactory.Set ("Interval", TimeValue (period));
+  m_trafficFactory.Set ("Poisson", BooleanValue (poisson));
+  m_traffic = true;
+}
+
+void
+LinearWsnHelper::SetPartitions (uint32_t partitions)
+{
+  NS_ABORT_MSG_IF (partitions == 0, "LinearWsnHelper: at least one partition needed");
+  m_partitions = partitions;
+}
+
+uint32_t
+LinearWsnHelper::GetPartition (uint32_t n, uint32_t i) const
+{
+  return static_cast<uint32_t> (uint64_t (i) * m_partitions / n);
+}
+
+uint32_t
+LinearWsnHelper::GetSegmentStart (uint32_t n, uint32_t partition) const
+{
+  // the first i with i * partitions / n >= partition
+  return static_cast<uint32_t> ((uint64_t (partition) * n + m_partitions - 1) / m_partitions);
+}
+
+NetDeviceContainer
+LinearWsnHelper::Create (uint32_t n, NodeContainer &nodes) const
+{
+  NS_ABORT_MSG_IF (m_partitions > n, "LinearWsnHelper: more partitions than nodes");
+  if (m_partitions == 1)
+    {
+      NodeContainer c;
+      for (uint32_t i = 0; i < n; ++i)
+        {
+          c.Add (CreateObject<Node> ());
+        }
+      nodes.Add (c);
+      return Install (c);
+    }
+
+  NS_ABORT_MSG_IF (n > 0xffff, "LinearWsnHelper: sids are 16 bits, " << n << " nodes");
+  uint32_t self = Simulator::GetSystemId ();
+  uint32_t first = GetSegmentStart (n, self);
+  uint32_t end = GetSegmentStart (n, self + 1);
+  NS_ASSERT (first < end);
+  // the segment's own nodes first, so that their ids follow the same
+  // arithmetic on every partition, then the stubs of its two neighbors
+  NodeContainer segment;
+  for (uint32_t i = first; i < end; ++i)
+    {
+      segment.Add (CreateObject<Node> (self));
+    }
+  NodeContainer c;
+  if (first > 0)
+    {
+      c.Add (CreateObject<Node> (GetPartition (n, first - 1)));
+    }
+  c.Add (segment);
+  if (end < n)
+    {
+      c.Add (CreateObject<Node> (GetPartition (n, end)));
+    }
+  nodes.Add (c);
+
+  uint32_t lo = first > 0 ? first - 1 : first;
+  ObjectFactory scheduleFactory = m_scheduleFactory;
+  scheduleFactory.Set ("NNodes", UintegerValue (n));
+  Ptr<LwsnSlotSchedule> schedule = scheduleFactory.Create<LwsnSlotSchedule> ();
+  schedule->SetRows (lo + 1, lo + c.GetN ());
+  return InstallRange (c, lo + 1, m_channelFactory.Create<SimpleChannel> (), schedule);
+}
+
+NetDeviceContainer
+LinearWsnHelper::Install (const NodeContainer &c) const
+{
+  NS_ABORT_MSG_IF (c.GetN () > 0xffff, "LinearWsnHelper: sids are 16 bits, " << c.GetN () << " nodes");
+  ObjectFactory scheduleFactory = m_scheduleFactory;
+  scheduleFactory.Set ("NNodes", UintegerValue (c.GetN ()));
+  return Install (c, m_channelFactory.Create<SimpleChannel> (),
+                  scheduleFactory.Create<LwsnSlotSchedule> ());
+}
+
+NetDeviceContainer
+LinearWsnHelper::Install (const NodeContainer &c, Ptr<SimpleChannel> channel,
+                          Ptr<LwsnSlotSchedule> schedule) const
+{
+  NS_ABORT_MSG_IF (c.GetN () < 2, "LinearWsnHelper: a chain needs at least 2 nodes");
+  NS_ABORT_MSG_IF (schedule->GetNNodes () != c.GetN (),
+                   "LinearWsnHelper: schedule is for " << schedule->GetNNodes ()
+                   << " nodes, chain has " << c.GetN ());
+  return InstallRange (c, 1, channel, schedule);
+}
+
+NetDeviceContainer
+LinearWsnHelper::InstallRange (const NodeContainer &c, uint16_t firstSid,
+                               Ptr<SimpleChannel> channel, Ptr<LwsnSlotSchedule> schedule) const
+{
+  uint32_t n = c.GetN ();
+  NS_LOG_FUNCTION (this << n << firstSid << channel << schedule);
+
+  NetDeviceContainer devices;
+  std::vector<Ptr<SimpleNetDevice> > devs;
+  devs.reserve (n);
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      uint16_t sid = firstSid + i;
+      Ptr<SimpleNetDevice> device = m_deviceFactory.Create<SimpleNetDevice> ();
+      device->SetAddress (m_partitions == 1 ? Mac48Address::Allocate () : SidAddress (sid));
+      device->SetSid (sid);
+      device->SetSlotSchedule (schedule);
+      device->SetChannel (channel);
+      c.Get (i)->AddDevice (device);
+      devices.Add (device);
+      devs.push_back (device);
+    }
+
+  for (uint32_t i = 0; i < n; ++i)
+    {
+      Address left = devs[i == 0 ? i : i - 1]->GetAddress ();
+      Address right = devs[i == n - 1 ? i : i + 1]->GetAddress ();
+      devs[i]->SetSideAddress (left, right);
+      if (m_traffic && c.Get (i)->GetSystemId () == Simulator::GetSystemId ())
+        {
+          Ptr<Application> app = m_trafficFactory.Create<Application> ();
+          app->SetStartTime (m_trafficStart);
+          c.Get (i)->AddApplication (app);
+        }
+    }
+  return devices;
+}
+
+} // namespace ns3
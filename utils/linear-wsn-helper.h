@@ -0,0 +1,213 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LINEAR_WSN_HELPER_H
+#define LINEAR_WSN_HELPER_H
+
+#include <string>
+
+#include "ns3/attribute.h"
+#include "ns3/object-factory.h"
+#include "ns3/net-device-container.h"
+#include "ns3/node-container.h"
+#include "ns3/nstime.h"
+#include "simple-net-device.h"
+#include "lwsn-slot-schedule.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Build a linear WSN chain of SimpleNetDevices.
+ *
+ * Install gives the i-th node of a container sid i+1, a fresh MAC
+ * address and a SimpleNetDevice on one SimpleChannel shared by the whole
+ * chain, and links every device to its left and right neighbors.  The
+ * ends of the chain use their own address for the missing neighbor.  All
+ * devices share one LwsnSlotSchedule sized for the chain; its table is
+ * only generated when the first device looks it up, so installing costs
+ * time and memory linear in the number of nodes.
+ *
+ * The table itself is quadratic in the number of nodes: 16 N^2 bytes,
+ * 1.6 GB for a chain of 10^4 nodes, see LwsnSlotSchedule.  A sequential
+ * run is in practice limited by that memory, and an unpipelined frame
+ * only fits the 16-bit slot index up to some 8800 nodes.  Longer chains
+ * need Pipelined frames and a partitioned run, where each partition
+ * keeps the rows of its own segment, 16 N bytes per node it simulates.
+ * Sids are 16 bits, so no chain goes beyond 65535 nodes.
+ *
+ * If traffic is enabled, Install also gives every node an
+ * LwsnSensorApplication that sends readings of its own towards both
+ * ends of the chain.
+ *
+ * For a partitioned run, Create splits the chain into contiguous
+ * segments, one per partition, through the system id of the nodes.  A
+ * partition only builds its own segment plus one stub node for each
+ * neighbor across a segment boundary, which the channel hands the
+ * packets for the other partition to; its slot table keeps just the
+ * rows of those nodes.  Devices then get an address derived from their
+ * sid, so that all partitions agree on it.
+ *
+ * A partitioned run delivers the same readings with the same latencies
+ * as a run of one partition only if both use the same channel Delay and
+ * every other attribute alike.  The Delay has to be positive, since it
+ * is the lookahead of the partitions.  It also has to be below one slot,
+ * so that a frame still arrives in the slot it was sent in.  Runs with
+ * different delays, such as the zero-delay channel of Install, do not
+ * compare.  Events of one time stamp may be handled in another order
+ * across partitions, so traces agree only once sorted.  The
+ * lwsn-parallel example prints per-flow results in a form that can be
+ * compared this way.
+ */
+class LinearWsnHelper
+{
+public:
+  /**
+   * Construct a LinearWsnHelper.  The slot schedule defaults to
+   * FrameLength 0, that is the shortest frame the chain fits in.
+   */
+  LinearWsnHelper ();
+  virtual ~LinearWsnHelper () {}
+
+  /**
+   * \param n1 the name of the attribute to set
+   * \param v1 the value of the attribute to set
+   *
+   * Set these attributes on each ns3::SimpleNetDevice created by Install.
+   */
+  void SetDeviceAttribute (std::string n1, const AttributeValue &v1);
+
+  /**
+   * \param n1 the name of the attribute to set
+   * \param v1 the value of the attribute to set
+   *
+   * Set these attributes on the ns3::SimpleChannel created by Install.
+   */
+  void SetChannelAttribute (std::string n1, const AttributeValue &v1);
+
+  /**
+   * \param n1 the name of the attribute to set
+   * \param v1 the value of the attribute to set
+   *
+   * Set these attributes on the ns3::LwsnSlotSchedule created by
+   * Install.  NNodes is always set to the size of the chain.
+   */
+  void SetScheduleAttribute (std::string n1, const AttributeValue &v1);
+
+  /**
+   * \param n1 the name of the attribute to set
+   * \param v1 the value of the attribute to set
+   *
+   * Set these attributes on each ns3::LwsnSensorApplication created by
+   * Install once traffic is enabled.
+   */
+  void SetTrafficAttribute (std::string n1, const AttributeValue &v1);
+
+  /**
+   * Make every node installed afterwards originate a reading of the
+   * given size each period, starting at start.
+   *
+   * \param start time of the first reading
+   * \param size payload size in bytes, sequence number included
+   * \param period time between two readings of one node, the mean time
+   *        with Poisson arrivals; zero means once per frame of the slot
+   *        schedule
+   * \param poisson take readings at exponentially distributed gaps
+   */
+  void EnableTraffic (Time start, uint32_t size, Time period = Seconds (0), bool poisson = false);
+
+  /**
+   * \param partitions number of contiguous segments Create splits the
+   *        chain into, one per partition; 1 for a sequential run
+   */
+  void SetPartitions (uint32_t partitions);
+
+  /**
+   * Create a chain of n nodes and install it.  With more than one
+   * partition, only the segment of this partition and its stubs are
+   * created.  The segment's nodes come first, in sid order, so on the
+   * partition that simulates it the node with index i has id
+   * f + i - GetSegmentStart (n, GetPartition (n, i)), where f is the id
+   * of the first node Create made; running the same script everywhere
+   * makes f the same on every partition.
+   *
+   * \param n number of nodes, at least 2
+   * \param nodes filled with the created nodes
+   * \return the devices, in sid order
+   */
+  NetDeviceContainer Create (uint32_t n, NodeContainer &nodes) const;
+
+  /**
+   * \param n number of nodes in the chain
+   * \param i index of a node, its sid minus one
+   * \return the partition that simulates the node, i * partitions / n
+   */
+  uint32_t GetPartition (uint32_t n, uint32_t i) const;
+
+  /**
+   * \param n number of nodes in the chain
+   * \param partition a partition, or the number of partitions for the
+   *        end of the last segment
+   * \return the index of the first node of the partition's segment
+   */
+  uint32_t GetSegmentStart (uint32_t n, uint32_t partition) const;
+
+  /**
+   * Install a chain on the nodes of c, in container order.
+   *
+   * \param c the nodes, at least 2
+   * \return the devices, in sid order
+   */
+  NetDeviceContainer Install (const NodeContainer &c) const;
+
+  /**
+   * Install a chain on the nodes of c, in container order, on an
+   * existing channel and slot schedule.
+   *
+   * \param c the nodes, at least 2
+   * \param channel channel the devices are attached to
+   * \param schedule slot table the devices share
+   * \return the devices, in sid order
+   */
+  NetDeviceContainer Install (const NodeContainer &c, Ptr<SimpleChannel> channel,
+                              Ptr<LwsnSlotSchedule> schedule) const;
+
+private:
+  /**
+   * Install the devices of consecutive sids, starting at firstSid, on
+   * the nodes of c; the ends of c are treated as the ends of the chain.
+   *
+   * \param c the nodes
+   * \param firstSid sid of the first node
+   * \param channel channel the devices are attached to
+   * \param schedule slot table the devices share
+   * \return the devices, in sid order
+   */
+  NetDeviceContainer InstallRange (const NodeContainer &c, uint16_t firstSid,
+                                   Ptr<SimpleChannel> channel, Ptr<LwsnSlotSchedule> schedule) const;
+
+  ObjectFactory m_deviceFactory;   //!< device factory
+  ObjectFactory m_channelFactory;  //!< channel factory
+  ObjectFactory m_scheduleFactory; //!< slot schedule factory
+  ObjectFactory m_trafficFactory;  //!< sensor application factory
+  Time m_trafficStart;             //!< time of the first reading
+  bool m_traffic;                  //!< true if Install adds sensor applications
+  uint32_t m_partitions;           //!< segments Create splits the chain into
+};
+
+} // namespace ns3
+
+#endif /* LINEAR_WSN_HELPER_H */
@@ -0,0 +1,127 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lwsn-aggregate-header.h"
+#include "ns3/assert.h"
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (LwsnAggregateHeader);
+
+TypeId
+LwsnAggregateHeader::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LwsnAggregateHeader")
+    .SetParent<Header> ()
+    .SetGroupName ("Network")
+    .AddConstructor<LwsnAggregateHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+LwsnAggregateHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+LwsnAggregateHeader::LwsnAggregateHeader ()
+{
+}
+
+void
+LwsnAggregateHeader::Print (std::ostream &os) const
+{
+  os << "readings=";
+  for (uint32_t i = 0; i < m_seqs.size (); ++i)
+    {
+      os << (i ? "," : "") << m_seqs[i] << ":" << m_sizes[i];
+    }
+}
+
+uint32_t
+LwsnAggregateHeader::GetHeaderSize (uint32_t readings)
+{
+  return 1 + 6 * readings;
+}
+
+uint32_t
+LwsnAggregateHeader::GetSerializedSize (void) const
+{
+  return GetHeaderSize (m_seqs.size ());
+}
+
+void
+LwsnAggregateHeader::Serialize (Buffer::Iterator start) const
+{
+  start.WriteU8 (m_seqs.size ());
+  for (uint32_t i = 0; i < m_seqs.size (); ++i)
+    {
+      start.WriteHtonU32 (m_seqs[i]);
+      start.WriteHtonU16 (m_sizes[i]);
+    }
+}
+
+uint32_t
+LwsnAggregateHeader::Deserialize (Buffer::Iterator start)
+{
+  uint8_t n = start.ReadU8 ();
+  m_seqs.resize (n);
+  m_sizes.resize (n);
+  for (uint8_t i = 0; i < n; ++i)
+    {
+      m_seqs[i] = start.ReadNtohU32 ();
+      m_sizes[i] = start.ReadNtohU16 ();
+    }
+  return GetSerializedSize ();
+}
+
+void
+LwsnAggregateHeader::AddReading (uint32_t seq, uint16_t size)
+{
+  NS_ASSERT (m_seqs.size () < 0xff);
+  m_seqs.push_back (seq);
+  m_sizes.push_back (size);
+}
+
+void
+LwsnAggregateHeader::Append (const LwsnAggregateHeader &other)
+{
+  NS_ASSERT (m_seqs.size () + other.m_seqs.size () <= 0xff);
+  m_seqs.insert (m_seqs.end (), other.m_seqs.begin (), other.m_seqs.end ());
+  m_sizes.insert (m_sizes.end (), other.m_sizes.begin (), other.m_sizes.end ());
+}
+
+uint8_t
+LwsnAggregateHeader::GetNReadings (void) const
+{
+  return m_seqs.size ();
+}
+
+uint32_t
+LwsnAggregateHeader::GetSequence (uint8_t i) const
+{
+  NS_ASSERT (i < m_seqs.size ());
+  return m_seqs[i];
+}
+
+uint16_t
+LwsnAggregateHeader::GetSize (uint8_t i) const
+{
+  NS_ASSERT (i < m_sizes.size ());
+  return m_sizes[i];
+}
+
+} // namespace ns3
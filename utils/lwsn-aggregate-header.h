@@ -0,0 +1,97 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_AGGREGATE_HEADER_H
+#define LWSN_AGGREGATE_HEADER_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "ns3/header.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Header of a frame that carries several readings of one flow.
+ *
+ * With aggregation on, this header replaces the LwsnReadingHeader
+ * behind the LwsnHeader of every data frame.  It holds a small
+ * sub-header per reading, its sequence number and payload size, and
+ * the payloads follow it back to back in the same order.  The origin
+ * of all readings is the Osid of the LwsnHeader: the slot table
+ * schedules flows by origin, so only readings of one origin share a
+ * frame.  A coded frame XORs two such frames whole.
+ */
+class LwsnAggregateHeader : public Header
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  LwsnAggregateHeader ();
+
+  virtual void Print (std::ostream &os) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+  /**
+   * Append the sub-header of the next reading.
+   *
+   * \param seq sequence number of the reading at its origin
+   * \param size payload size in bytes, without the sequence number
+   */
+  void AddReading (uint32_t seq, uint16_t size);
+  /**
+   * Append the sub-headers of another frame's readings.
+   *
+   * \param other header of the frame whose payloads follow this one's
+   */
+  void Append (const LwsnAggregateHeader &other);
+  /**
+   * \return the number of readings in the frame
+   */
+  uint8_t GetNReadings (void) const;
+  /**
+   * \param i index of a reading
+   * \return its sequence number
+   */
+  uint32_t GetSequence (uint8_t i) const;
+  /**
+   * \param i index of a reading
+   * \return its payload size in bytes
+   */
+  uint16_t GetSize (uint8_t i) const;
+
+  /**
+   * \param readings number of readings
+   * \return the serialized size of a header with that many readings
+   */
+  static uint32_t GetHeaderSize (uint32_t readings);
+
+private:
+  std::vector<uint32_t> m_seqs;  //!< sequence number per reading
+  std::vector<uint16_t> m_sizes; //!< payload size per reading
+};
+
+} // namespace ns3
+
+#endif /* LWSN_AGGREGATE_HEADER_H */
@@ -0,0 +1,145 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lwsn-coding-buffer.h"
+#include "ns3/assert.h"
+
+namespace ns3 {
+
+LwsnCodingBuffer::LwsnCodingBuffer (uint32_t depth, uint32_t maxAge)
+  : m_depth (depth),
+    m_maxAge (maxAge),
+    m_nPackets (0),
+    m_order (0)
+{
+  NS_ASSERT (depth > 0);
+}
+
+void
+LwsnCodingBuffer::SetLimits (uint32_t depth, uint32_t maxAge)
+{
+  NS_ASSERT (depth > 0);
+  Clear ();
+  m_depth = depth;
+  m_maxAge = maxAge;
+}
+
+LwsnCodingBuffer::Item *
+LwsnCodingBuffer::Ring (uint16_t osid)
+{
+  uint32_t first = (uint32_t)osid * m_depth;
+  if (first + m_depth > m_items.size ())
+    {
+      Item none = { 0, 0, 0, 0 };
+      m_items.resize (first + m_depth, none);
+    }
+  return &m_items[first];
+}
+
+bool
+LwsnCodingBuffer::Valid (Item &item, uint64_t frame)
+{
+  if (item.packet == 0)
+    {
+      return false;
+    }
+  if (item.frame + m_maxAge < frame)
+    {
+      item.packet = 0;
+      --m_nPackets;
+      return false;
+    }
+  return true;
+}
+
+void
+LwsnCodingBuffer::Insert (uint16_t osid, uint32_t seq, Ptr<Packet> packet, uint64_t frame)
+{
+  NS_ASSERT (packet != 0);
+  Item *ring = Ring (osid);
+  Item *victim = &ring[0];
+  for (uint32_t i = 0; i < m_depth; ++i)
+    {
+      if (!Valid (ring[i], frame))
+        {
+          victim = &ring[i];
+          break;
+        }
+      if (ring[i].order < victim->order)
+        {
+          victim = &ring[i];
+        }
+    }
+  if (victim->packet == 0)
+    {
+      ++m_nPackets;
+    }
+  victim->packet = packet;
+  victim->seq = seq;
+  victim->frame = frame;
+  victim->order = ++m_order;
+}
+
+Ptr<Packet>
+LwsnCodingBuffer::Find (uint16_t osid, uint32_t seq, uint64_t frame)
+{
+  Item *ring = Ring (osid);
+  Item *found = 0;
+  for (uint32_t i = 0; i < m_depth; ++i)
+    {
+      if (Valid (ring[i], frame) && ring[i].seq == seq && (found == 0 || ring[i].order > found->order))
+        {
+          found = &ring[i];
+        }
+    }
+  return found ? found->packet : 0;
+}
+
+Ptr<Packet>
+LwsnCodingBuffer::Remove (uint16_t osid, uint32_t seq, uint64_t frame)
+{
+  Item *ring = Ring (osid);
+  Item *found = 0;
+  for (uint32_t i = 0; i < m_depth; ++i)
+    {
+      if (Valid (ring[i], frame) && ring[i].seq == seq && (found == 0 || ring[i].order > found->order))
+        {
+          found = &ring[i];
+        }
+    }
+  if (found == 0)
+    {
+      return 0;
+    }
+  Ptr<Packet> packet = found->packet;
+  found->packet = 0;
+  --m_nPackets;
+  return packet;
+}
+
+uint32_t
+LwsnCodingBuffer::GetNPackets (void) const
+{
+  return m_nPackets;
+}
+
+void
+LwsnCodingBuffer::Clear (void)
+{
+  m_items.clear ();
+  m_nPackets = 0;
+}
+
+} // namespace ns3
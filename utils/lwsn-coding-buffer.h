@@ -0,0 +1,126 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_CODING_BUFFER_H
+#define LWSN_CODING_BUFFER_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "ns3/ptr.h"
+#include "ns3/packet.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Bounded store of packets indexed by origin sid and sequence.
+ *
+ * Each origin sid owns a ring of Depth entries in one flat array, so
+ * insertion and lookup touch a constant number of entries.  Inserting
+ * into a full ring evicts that origin's oldest packet; entries stamped
+ * more than MaxAge frames before the frame a caller passes in are
+ * treated as gone and dropped when next touched.
+ *
+ * A relay keeps one buffer of received packets waiting for a coding
+ * partner and one of packets it has sent, which decoding XORs back out.
+ */
+class LwsnCodingBuffer
+{
+public:
+  /**
+   * \param depth packets kept per origin sid
+   * \param maxAge frames a packet stays valid
+   */
+  LwsnCodingBuffer (uint32_t depth = 4, uint32_t maxAge = 2);
+
+  /**
+   * Change the limits; drops everything currently buffered.
+   *
+   * \param depth packets kept per origin sid
+   * \param maxAge frames a packet stays valid
+   */
+  void SetLimits (uint32_t depth, uint32_t maxAge);
+
+  /**
+   * \param osid origin sid
+   * \param seq origin sequence number
+   * \param packet packet to store
+   * \param frame current frame
+   */
+  void Insert (uint16_t osid, uint32_t seq, Ptr<Packet> packet, uint64_t frame);
+
+  /**
+   * \param osid origin sid
+   * \param seq origin sequence number
+   * \param frame current frame
+   * \return the newest valid packet with this origin and sequence, or 0
+   */
+  Ptr<Packet> Find (uint16_t osid, uint32_t seq, uint64_t frame);
+
+  /**
+   * Remove and return the newest valid packet with this origin and
+   * sequence.
+   *
+   * \param osid origin sid
+   * \param seq origin sequence number
+   * \param frame current frame
+   * \return the packet, or 0 if none is buffered
+   */
+  Ptr<Packet> Remove (uint16_t osid, uint32_t seq, uint64_t frame);
+
+  /// \return the number of packets held, including expired ones not yet dropped
+  uint32_t GetNPackets (void) const;
+
+  /// Drop every packet.
+  void Clear (void);
+
+private:
+  /**
+   * A buffered packet.
+   */
+  struct Item
+  {
+    Ptr<Packet> packet; //!< buffered packet, 0 if the entry is free
+    uint32_t seq;       //!< origin sequence number
+    uint64_t frame;     //!< frame the packet was stored in
+    uint64_t order;     //!< insertion counter, larger is newer
+  };
+
+  /**
+   * \param osid origin sid
+   * \return the first entry of the origin's ring, growing the array if needed
+   */
+  Item *Ring (uint16_t osid);
+
+  /**
+   * Free the entry if it is older than MaxAge frames.
+   * \param item entry to check
+   * \param frame current frame
+   * \return true if the entry holds a valid packet
+   */
+  bool Valid (Item &item, uint64_t frame);
+
+  uint32_t m_depth;           //!< entries per origin
+  uint32_t m_maxAge;          //!< frames a packet stays valid
+  uint32_t m_nPackets;        //!< occupied entries
+  uint64_t m_order;           //!< insertion counter
+  std::vector<Item> m_items;  //!< rings of m_depth entries, one per origin sid
+};
+
+} // namespace ns3
+
+#endif /* LWSN_CODING_BUFFER_H */
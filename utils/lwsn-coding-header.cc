@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lwsn-coding-header.h"
+#include "ns3/assert.h"
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (LwsnCodingHeader);
+
+TypeId
+LwsnCodingHeader::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LwsnCodingHeader")
+    .SetParent<Header> ()
+    .SetGroupName ("Network")
+    .AddConstructor<LwsnCodingHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+LwsnCodingHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+LwsnCodingHeader::LwsnCodingHeader ()
+{
+}
+
+void
+LwsnCodingHeader::Print (std::ostream &os) const
+{
+  os << "flows=";
+  for (uint32_t i = 0; i < m_lengths.size (); ++i)
+    {
+      os << (i ? "," : "") << m_seqs[i] << ":" << m_lengths[i];
+    }
+}
+
+uint32_t
+LwsnCodingHeader::GetSerializedSize (void) const
+{
+  return 1 + 6 * m_lengths.size ();
+}
+
+void
+LwsnCodingHeader::Serialize (Buffer::Iterator start) const
+{
+  start.WriteU8 (m_lengths.size ());
+  for (uint32_t i = 0; i < m_lengths.size (); ++i)
+    {
+      start.WriteHtonU16 (m_lengths[i]);
+      start.WriteHtonU32 (m_seqs[i]);
+    }
+}
+
+uint32_t
+LwsnCodingHeader::Deserialize (Buffer::Iterator start)
+{
+  uint8_t n = start.ReadU8 ();
+  m_lengths.resize (n);
+  m_seqs.resize (n);
+  for (uint8_t i = 0; i < n; ++i)
+    {
+      m_lengths[i] = start.ReadNtohU16 ();
+      m_seqs[i] = start.ReadNtohU32 ();
+    }
+  return GetSerializedSize ();
+}
+
+void
+LwsnCodingHeader::AddFlow (uint16_t length, uint32_t seq)
+{
+  NS_ASSERT (m_lengths.size () < 0xff);
+  m_lengths.push_back (length);
+  m_seqs.push_back (seq);
+}
+
+uint16_t
+LwsnCodingHeader::GetLength (uint8_t i) const
+{
+  NS_ASSERT (i < m_lengths.size ());
+  return m_lengths[i];
+}
+
+uint32_t
+LwsnCodingHeader::GetSequence (uint8_t i) const
+{
+  NS_ASSERT (i < m_seqs.size ());
+  return m_seqs[i];
+}
+
+uint8_t
+LwsnCodingHeader::GetNFlows (void) const
+{
+  return m_lengths.size ();
+}
+
+} // namespace ns3
@@ -0,0 +1,85 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_CODING_HEADER_H
+#define LWSN_CODING_HEADER_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "ns3/header.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Header carried between the LwsnHeader and the payload of a coded
+ * packet.
+ *
+ * The coded payload is as long as the longest of the combined payloads;
+ * this header records the original length of each of them, in the order
+ * of the origin sids in the LwsnHeader (Osid, then Osid2), so that a
+ * receiver can strip the padding after decoding.  It also records the
+ * sequence number of each combined packet, the first reading's if it
+ * carries several, so that the receiver XORs out exactly the packet that
+ * was coded and not a later one of the same flow.
+ */
+class LwsnCodingHeader : public Header
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  LwsnCodingHeader ();
+
+  virtual void Print (std::ostream &os) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+  /**
+   * Append the next combined payload.
+   * \param length payload length in bytes
+   * \param seq sequence number of the packet
+   */
+  void AddFlow (uint16_t length, uint32_t seq);
+  /**
+   * \param i index of the combined payload
+   * \return its length in bytes
+   */
+  uint16_t GetLength (uint8_t i) const;
+  /**
+   * \param i index of the combined payload
+   * \return the sequence number of its packet
+   */
+  uint32_t GetSequence (uint8_t i) const;
+  /**
+   * \return the number of combined payloads
+   */
+  uint8_t GetNFlows (void) const;
+
+private:
+  std::vector<uint16_t> m_lengths; //!< payload lengths, one per coded flow
+  std::vector<uint32_t> m_seqs;    //!< sequence numbers, one per coded flow
+};
+
+} // namespace ns3
+
+#endif /* LWSN_CODING_HEADER_H */
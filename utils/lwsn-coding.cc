@@ -0,0 +1,432 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include <cstring>
+
+#include "lwsn-coding.h"
+
+#if defined (__GNUC__) && (defined (__x86_64__) || defined (__i386__))
+#define LWSN_CODING_X86 1
+#include <immintrin.h>
+#endif
+
+namespace ns3 {
+
+namespace LwsnCoding {
+
+namespace {
+
+void
+XorScalar (uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+  uint32_t i = 0;
+  for (; i + sizeof (uint64_t) <= len; i += sizeof (uint64_t))
+    {
+      uint64_t a;
+      uint64_t b;
+      std::memcpy (&a, dst + i, sizeof (a));
+      std::memcpy (&b, src + i, sizeof (b));
+      a ^= b;
+      std::memcpy (dst + i, &a, sizeof (a));
+    }
+  for (; i < len; ++i)
+    {
+      dst[i] ^= src[i];
+    }
+}
+
+#ifdef LWSN_CODING_X86
+__attribute__ ((target ("sse2"))) void
+XorSse2 (uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+  uint32_t i = 0;
+  for (; i + 64 <= len; i += 64)
+    {
+      __m128i a0 = _mm_loadu_si128 ((const __m128i *)(dst + i));
+      __m128i a1 = _mm_loadu_si128 ((const __m128i *)(dst + i + 16));
+      __m128i a2 = _mm_loadu_si128 ((const __m128i *)(dst + i + 32));
+      __m128i a3 = _mm_loadu_si128 ((const __m128i *)(dst + i + 48));
+      a0 = _mm_xor_si128 (a0, _mm_loadu_si128 ((const __m128i *)(src + i)));
+      a1 = _mm_xor_si128 (a1, _mm_loadu_si128 ((const __m128i *)(src + i + 16)));
+      a2 = _mm_xor_si128 (a2, _mm_loadu_si128 ((const __m128i *)(src + i + 32)));
+      a3 = _mm_xor_si128 (a3, _mm_loadu_si128 ((const __m128i *)(src + i + 48)));
+      _mm_storeu_si128 ((__m128i *)(dst + i), a0);
+      _mm_storeu_si128 ((__m128i *)(dst + i + 16), a1);
+      _mm_storeu_si128 ((__m128i *)(dst + i + 32), a2);
+      _mm_storeu_si128 ((__m128i *)(dst + i + 48), a3);
+    }
+  for (; i + 16 <= len; i += 16)
+    {
+      __m128i a = _mm_loadu_si128 ((const __m128i *)(dst + i));
+      a = _mm_xor_si128 (a, _mm_loadu_si128 ((const __m128i *)(src + i)));
+      _mm_storeu_si128 ((__m128i *)(dst + i), a);
+    }
+  XorScalar (dst + i, src + i, len - i);
+}
+
+__attribute__ ((target ("avx2"))) void
+XorAvx2 (uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+  uint32_t i = 0;
+  for (; i + 128 <= len; i += 128)
+    {
+      __m256i a0 = _mm256_loadu_si256 ((const __m256i *)(dst + i));
+      __m256i a1 = _mm256_loadu_si256 ((const __m256i *)(dst + i + 32));
+      __m256i a2 = _mm256_loadu_si256 ((const __m256i *)(dst + i + 64));
+      __m256i a3 = _mm256_loadu_si256 ((const __m256i *)(dst + i + 96));
+      a0 = _mm256_xor_si256 (a0, _mm256_loadu_si256 ((const __m256i *)(src + i)));
+      a1 = _mm256_xor_si256 (a1, _mm256_loadu_si256 ((const __m256i *)(src + i + 32)));
+      a2 = _mm256_xor_si256 (a2, _mm256_loadu_si256 ((const __m256i *)(src + i + 64)));
+      a3 = _mm256_xor_si256 (a3, _mm256_loadu_si256 ((const __m256i *)(src + i + 96)));
+      _mm256_storeu_si256 ((__m256i *)(dst + i), a0);
+      _mm256_storeu_si256 ((__m256i *)(dst + i + 32), a1);
+      _mm256_storeu_si256 ((__m256i *)(dst + i + 64), a2);
+      _mm256_storeu_si256 ((__m256i *)(dst + i + 96), a3);
+    }
+  for (; i + 32 <= len; i += 32)
+    {
+      __m256i a = _mm256_loadu_si256 ((const __m256i *)(dst + i));
+      a = _mm256_xor_si256 (a, _mm256_loadu_si256 ((const __m256i *)(src + i)));
+      _mm256_storeu_si256 ((__m256i *)(dst + i), a);
+    }
+  XorSse2 (dst + i, src + i, len - i);
+}
+#endif /* LWSN_CODING_X86 */
+
+typedef void (*XorKernel)(uint8_t *, const uint8_t *, uint32_t);
+
+/**
+ * Kernel chosen for the running CPU.
+ */
+struct XorDispatch
+{
+  XorDispatch ()
+  {
+    Select (false);
+  }
+  /**
+   * \param scalar take the portable kernel whatever the CPU supports
+   */
+  void Select (bool scalar)
+  {
+    kernel = &XorScalar;
+    name = "scalar";
+#ifdef LWSN_CODING_X86
+    __builtin_cpu_init ();
+    if (scalar)
+      {
+        return;
+      }
+    if (__builtin_cpu_supports ("avx2"))
+      {
+        kernel = &XorAvx2;
+        name = "avx2";
+      }
+    else if (__builtin_cpu_supports ("sse2"))
+      {
+        kernel = &XorSse2;
+        name = "sse2";
+      }
+#endif
+  }
+  XorKernel kernel;   //!< selected kernel
+  const char *name;   //!< name of the selected kernel
+};
+
+XorDispatch &
+GetXorDispatch (void)
+{
+  static XorDispatch dispatch;
+  return dispatch;
+}
+
+/**
+ * Lookup tables for GF(2^8), built once.
+ */
+struct GfTables
+{
+  GfTables ()
+  {
+    uint16_t x = 1;
+    for (int i = 0; i < 255; ++i)
+      {
+        exp[i] = x;
+        exp[i + 255] = x;
+        log[x] = i;
+        x <<= 1;
+        if (x & 0x100)
+          {
+            x ^= 0x11d;
+          }
+      }
+    log[0] = 0;
+    for (int a = 0; a < 256; ++a)
+      {
+        for (int b = 0; b < 256; ++b)
+          {
+            mul[a][b] = (a && b) ? exp[log[a] + log[b]] : 0;
+          }
+        for (int n = 0; n < 16; ++n)
+          {
+            lo[a][n] = mul[a][n];
+            hi[a][n] = mul[a][n << 4];
+          }
+        inv[a] = a ? exp[255 - log[a]] : 0;
+      }
+  }
+  uint8_t exp[510];       //!< powers of the generator, doubled to skip a modulo
+  uint8_t log[256];       //!< discrete logarithms
+  uint8_t inv[256];       //!< multiplicative inverses
+  uint8_t mul[256][256];  //!< full product table
+  uint8_t lo[256][16];    //!< c * n for the low nibble n
+  uint8_t hi[256][16];    //!< c * (n << 4) for the high nibble n
+};
+
+const GfTables &
+GetGfTables (void)
+{
+  static GfTables tables;
+  return tables;
+}
+
+void
+GfMulAddScalar (uint8_t *dst, const uint8_t *src, uint8_t c, uint32_t len)
+{
+  const uint8_t *row = GetGfTables ().mul[c];
+  for (uint32_t i = 0; i < len; ++i)
+    {
+      dst[i] ^= row[src[i]];
+    }
+}
+
+void
+GfScaleScalar (uint8_t *dst, uint8_t c, uint32_t len)
+{
+  const uint8_t *row = GetGfTables ().mul[c];
+  for (uint32_t i = 0; i < len; ++i)
+    {
+      dst[i] = row[dst[i]];
+    }
+}
+
+#ifdef LWSN_CODING_X86
+__attribute__ ((target ("ssse3"))) void
+GfMulAddSsse3 (uint8_t *dst, const uint8_t *src, uint8_t c, uint32_t len)
+{
+  const GfTables &t = GetGfTables ();
+  const __m128i lo = _mm_loadu_si128 ((const __m128i *)t.lo[c]);
+  const __m128i hi = _mm_loadu_si128 ((const __m128i *)t.hi[c]);
+  const __m128i mask = _mm_set1_epi8 (0x0f);
+  uint32_t i = 0;
+  for (; i + 16 <= len; i += 16)
+    {
+      __m128i s = _mm_loadu_si128 ((const __m128i *)(src + i));
+      __m128i l = _mm_shuffle_epi8 (lo, _mm_and_si128 (s, mask));
+      __m128i h = _mm_shuffle_epi8 (hi, _mm_and_si128 (_mm_srli_epi64 (s, 4), mask));
+      __m128i d = _mm_loadu_si128 ((const __m128i *)(dst + i));
+      _mm_storeu_si128 ((__m128i *)(dst + i), _mm_xor_si128 (d, _mm_xor_si128 (l, h)));
+    }
+  GfMulAddScalar (dst + i, src + i, c, len - i);
+}
+
+__attribute__ ((target ("ssse3"))) void
+GfScaleSsse3 (uint8_t *dst, uint8_t c, uint32_t len)
+{
+  const GfTables &t = GetGfTables ();
+  const __m128i lo = _mm_loadu_si128 ((const __m128i *)t.lo[c]);
+  const __m128i hi = _mm_loadu_si128 ((const __m128i *)t.hi[c]);
+  const __m128i mask = _mm_set1_epi8 (0x0f);
+  uint32_t i = 0;
+  for (; i + 16 <= len; i += 16)
+    {
+      __m128i s = _mm_loadu_si128 ((const __m128i *)(dst + i));
+      __m128i l = _mm_shuffle_epi8 (lo, _mm_and_si128 (s, mask));
+      __m128i h = _mm_shuffle_epi8 (hi, _mm_and_si128 (_mm_srli_epi64 (s, 4), mask));
+      _mm_storeu_si128 ((__m128i *)(dst + i), _mm_xor_si128 (l, h));
+    }
+  GfScaleScalar (dst + i, c, len - i);
+}
+
+__attribute__ ((target ("avx2"))) void
+GfMulAddAvx2 (uint8_t *dst, const uint8_t *src, uint8_t c, uint32_t len)
+{
+  const GfTables &t = GetGfTables ();
+  const __m256i lo = _mm256_broadcastsi128_si256 (_mm_loadu_si128 ((const __m128i *)t.lo[c]));
+  const __m256i hi = _mm256_broadcastsi128_si256 (_mm_loadu_si128 ((const __m128i *)t.hi[c]));
+  const __m256i mask = _mm256_set1_epi8 (0x0f);
+  uint32_t i = 0;
+  for (; i + 64 <= len; i += 64)
+    {
+      __m256i s0 = _mm256_loadu_si256 ((const __m256i *)(src + i));
+      __m256i s1 = _mm256_loadu_si256 ((const __m256i *)(src + i + 32));
+      __m256i p0 = _mm256_xor_si256 (_mm256_shuffle_epi8 (lo, _mm256_and_si256 (s0, mask)),
+                                     _mm256_shuffle_epi8 (hi, _mm256_and_si256 (_mm256_srli_epi64 (s0, 4), mask)));
+      __m256i p1 = _mm256_xor_si256 (_mm256_shuffle_epi8 (lo, _mm256_and_si256 (s1, mask)),
+                                     _mm256_shuffle_epi8 (hi, _mm256_and_si256 (_mm256_srli_epi64 (s1, 4), mask)));
+      __m256i d0 = _mm256_loadu_si256 ((const __m256i *)(dst + i));
+      __m256i d1 = _mm256_loadu_si256 ((const __m256i *)(dst + i + 32));
+      _mm256_storeu_si256 ((__m256i *)(dst + i), _mm256_xor_si256 (d0, p0));
+      _mm256_storeu_si256 ((__m256i *)(dst + i + 32), _mm256_xor_si256 (d1, p1));
+    }
+  for (; i + 32 <= len; i += 32)
+    {
+      __m256i s = _mm256_loadu_si256 ((const __m256i *)(src + i));
+      __m256i l = _mm256_shuffle_epi8 (lo, _mm256_and_si256 (s, mask));
+      __m256i h = _mm256_shuffle_epi8 (hi, _mm256_and_si256 (_mm256_srli_epi64 (s, 4), mask));
+      __m256i d = _mm256_loadu_si256 ((const __m256i *)(dst + i));
+      _mm256_storeu_si256 ((__m256i *)(dst + i), _mm256_xor_si256 (d, _mm256_xor_si256 (l, h)));
+    }
+  GfMulAddSsse3 (dst + i, src + i, c, len - i);
+}
+
+__attribute__ ((target ("avx2"))) void
+GfScaleAvx2 (uint8_t *dst, uint8_t c, uint32_t len)
+{
+  const GfTables &t = GetGfTables ();
+  const __m256i lo = _mm256_broadcastsi128_si256 (_mm_loadu_si128 ((const __m128i *)t.lo[c]));
+  const __m256i hi = _mm256_broadcastsi128_si256 (_mm_loadu_si128 ((const __m128i *)t.hi[c]));
+  const __m256i mask = _mm256_set1_epi8 (0x0f);
+  uint32_t i = 0;
+  for (; i + 32 <= len; i += 32)
+    {
+      __m256i s = _mm256_loadu_si256 ((const __m256i *)(dst + i));
+      __m256i l = _mm256_shuffle_epi8 (lo, _mm256_and_si256 (s, mask));
+      __m256i h = _mm256_shuffle_epi8 (hi, _mm256_and_si256 (_mm256_srli_epi64 (s, 4), mask));
+      _mm256_storeu_si256 ((__m256i *)(dst + i), _mm256_xor_si256 (l, h));
+    }
+  GfScaleSsse3 (dst + i, c, len - i);
+}
+#endif /* LWSN_CODING_X86 */
+
+typedef void (*GfMulAddKernel)(uint8_t *, const uint8_t *, uint8_t, uint32_t);
+typedef void (*GfScaleKernel)(uint8_t *, uint8_t, uint32_t);
+
+/**
+ * GF(2^8) kernels chosen for the running CPU.
+ */
+struct GfDispatch
+{
+  GfDispatch ()
+  {
+    GetGfTables ();
+    Select (false);
+  }
+  /**
+   * \param scalar take the table kernels whatever the CPU supports
+   */
+  void Select (bool scalar)
+  {
+    mulAdd = &GfMulAddScalar;
+    scale = &GfScaleScalar;
+    name = "table";
+#ifdef LWSN_CODING_X86
+    __builtin_cpu_init ();
+    if (scalar)
+      {
+        return;
+      }
+    if (__builtin_cpu_supports ("avx2"))
+      {
+        mulAdd = &GfMulAddAvx2;
+        scale = &GfScaleAvx2;
+        name = "avx2";
+      }
+    else if (__builtin_cpu_supports ("ssse3"))
+      {
+        mulAdd = &GfMulAddSsse3;
+        scale = &GfScaleSsse3;
+        name = "ssse3";
+      }
+#endif
+  }
+  GfMulAddKernel mulAdd;  //!< selected multiply-add kernel
+  GfScaleKernel scale;    //!< selected scaling kernel
+  const char *name;       //!< name of the selected kernels
+};
+
+GfDispatch &
+GetGfDispatch (void)
+{
+  static GfDispatch dispatch;
+  return dispatch;
+}
+
+} // anonymous namespace
+
+void
+Xor (uint8_t *dst, const uint8_t *src, uint32_t len)
+{
+  GetXorDispatch ().kernel (dst, src, len);
+}
+
+const char *
+GetXorKernelName (void)
+{
+  return GetXorDispatch ().name;
+}
+
+uint8_t
+GfMul (uint8_t a, uint8_t b)
+{
+  return GetGfTables ().mul[a][b];
+}
+
+uint8_t
+GfInv (uint8_t a)
+{
+  return GetGfTables ().inv[a];
+}
+
+void
+GfMulAdd (uint8_t *dst, const uint8_t *src, uint8_t c, uint32_t len)
+{
+  if (c == 0)
+    {
+      return;
+    }
+  if (c == 1)
+    {
+      Xor (dst, src, len);
+      return;
+    }
+  GetGfDispatch ().mulAdd (dst, src, c, len);
+}
+
+void
+GfScale (uint8_t *dst, uint8_t c, uint32_t len)
+{
+  if (c == 1)
+    {
+      return;
+    }
+  GetGfDispatch ().scale (dst, c, len);
+}
+
+const char *
+GetGfKernelName (void)
+{
+  return GetGfDispatch ().name;
+}
+
+void
+SetScalarKernels (bool scalar)
+{
+  GetXorDispatch ().Select (scalar);
+  GetGfDispatch ().Select (scalar);
+}
+
+} // namespace LwsnCoding
+
+} // namespace ns3
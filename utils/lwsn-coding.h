@@ -0,0 +1,102 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_CODING_H
+#define LWSN_CODING_H
+
+#include <stdint.h>
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Payload kernels for network coding on the linear WSN chain.
+ *
+ * The kernels work on raw byte buffers so that the coding path costs one
+ * pass over the payload.  On x86 the widest instruction set the CPU
+ * supports is picked at run time: AVX2 or SSE2 for XOR, AVX2 or SSSE3
+ * (pshufb nibble lookups) for GF(2^8) multiplication.  Other targets use
+ * a portable word-at-a-time XOR and a full 64 KiB multiplication table.
+ */
+namespace LwsnCoding {
+
+/**
+ * XOR src into dst: dst[i] ^= src[i] for i in [0, len).
+ *
+ * \param dst buffer updated in place
+ * \param src buffer combined into dst
+ * \param len number of bytes
+ */
+void Xor (uint8_t *dst, const uint8_t *src, uint32_t len);
+
+/**
+ * \return the name of the XOR kernel selected for this CPU
+ */
+const char *GetXorKernelName (void);
+
+/**
+ * Multiply in GF(2^8) with the polynomial x^8 + x^4 + x^3 + x^2 + 1.
+ *
+ * \param a first factor
+ * \param b second factor
+ * \return a * b
+ */
+uint8_t GfMul (uint8_t a, uint8_t b);
+
+/**
+ * \param a non-zero field element
+ * \return the multiplicative inverse of a
+ */
+uint8_t GfInv (uint8_t a);
+
+/**
+ * Multiply src by c and add it into dst: dst[i] ^= c * src[i].
+ *
+ * \param dst buffer updated in place
+ * \param src buffer combined into dst
+ * \param c coefficient
+ * \param len number of bytes
+ */
+void GfMulAdd (uint8_t *dst, const uint8_t *src, uint8_t c, uint32_t len);
+
+/**
+ * Multiply a buffer by c in place: dst[i] = c * dst[i].
+ *
+ * \param dst buffer updated in place
+ * \param c coefficient
+ * \param len number of bytes
+ */
+void GfScale (uint8_t *dst, uint8_t c, uint32_t len);
+
+/**
+ * \return the name of the GF(2^8) kernel selected for this CPU
+ */
+const char *GetGfKernelName (void);
+
+/**
+ * Switch between the kernels picked for the CPU and the portable ones,
+ * so that the two can be checked against each other.  Not meant to be
+ * called while packets are being coded.
+ *
+ * \param scalar true for the portable kernels
+ */
+void SetScalarKernels (bool scalar);
+
+} // namespace LwsnCoding
+
+} // namespace ns3
+
+#endif /* LWSN_CODING_H */
@@ -0,0 +1,80 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_FIXED_SLOT_SCHEDULE_H
+#define LWSN_FIXED_SLOT_SCHEDULE_H
+
+#include <stdint.h>
+
+#include "lwsn-slot-schedule.h"
+#include "lwsn-fixed-slot-tables.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief LwsnSlotSchedule of a chain shape known at compile time.
+ *
+ * The route of every (sid, osid) pair and the delay from every slot of
+ * the frame to the slot that sends it on are constant arrays compiled in
+ * for the shape, see LwsnFixedSlotTables.  GetRoute and GetDelay are a
+ * single lookup into them and never build the table; the rest of the
+ * schedule, such as the transmit and receive slots of each sid, is still
+ * built on first use.  Only the shapes lwsn-fixed-tables generated
+ * tables for compile; other shapes use a plain LwsnSlotSchedule, which
+ * computes routes and delays from its table.
+ *
+ * \code
+ *   Ptr<LwsnSlotSchedule> schedule = LwsnFixedSlotSchedule<6, 13, 3>::Create ();
+ *   wsn.Install (nodes, channel, schedule);
+ * \endcode
+ *
+ * The delay table holds (NNodes + 1)^2 * FrameLength entries, so this
+ * suits the short chains of parameter studies, not million-node runs.
+ *
+ * \tparam NNodes number of sids in the chain
+ * \tparam FrameLength slots per frame
+ * \tparam ReuseDistance hops between two transmitters of one slot
+ * \tparam Pipelined value of the Pipelined attribute
+ */
+template <uint16_t NNodes, uint16_t FrameLength, uint16_t ReuseDistance, bool Pipelined = false>
+class LwsnFixedSlotSchedule
+{
+public:
+  /**
+   * \return a schedule of this shape that uses the compiled tables; set
+   *         other attributes such as DataRate on it before the devices
+   *         are installed, but not those of the shape, or the first
+   *         build aborts
+   */
+  static Ptr<LwsnSlotSchedule> Create (void)
+  {
+    typedef LwsnFixedSlotTables<NNodes, FrameLength, ReuseDistance, Pipelined> Tables;
+    Ptr<LwsnSlotSchedule> schedule = CreateObject<LwsnSlotSchedule> ();
+    schedule->SetAttribute ("NNodes", UintegerValue (NNodes));
+    schedule->SetAttribute ("FrameLength", UintegerValue (FrameLength));
+    schedule->SetAttribute ("ReuseDistance", UintegerValue (ReuseDistance));
+    schedule->SetAttribute ("Pipelined", BooleanValue (Pipelined));
+    schedule->SetTables (Tables::routes, Tables::delays, NNodes, FrameLength, ReuseDistance, Pipelined);
+    return schedule;
+  }
+};
+
+} // namespace ns3
+
+#endif /* LWSN_FIXED_SLOT_SCHEDULE_H */
@@ -0,0 +1,1180 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Generated by scratch/lwsn-fixed-tables.cc; do not edit.
+
+#include "lwsn-fixed-slot-tables.h"
+
+namespace ns3 {
+
+const LwsnSlotSchedule::Entry LwsnFixedSlotTables<6, 13, 3, false>::routes[49] = {
+  // sid 0
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  // sid 1
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  // sid 2
+  { 0, 0, 0, 0, 0 }, { 4, 2, 1, 3, 0 }, { 0, 0, 0, 0, 0 }, { 4, 2, 0, 1, 1 },
+  { 11, 1, 0, 0, 0 }, { 12, 1, 0, 0, 0 }, { 0, 1, 0, 0, 0 },
+  // sid 3
+  { 0, 0, 0, 0, 0 }, { 7, 2, 1, 5, 0 }, { 5, 2, 0, 4, 0 }, { 0, 0, 0, 0, 0 },
+  { 5, 2, 1, 2, 1 }, { 7, 2, 0, 1, 1 }, { 9, 1, 0, 0, 0 },
+  // sid 4
+  { 0, 0, 0, 0, 0 }, { 10, 1, 0, 0, 0 }, { 8, 2, 0, 6, 0 }, { 6, 2, 0, 5, 0 },
+  { 0, 0, 0, 0, 0 }, { 6, 2, 1, 3, 1 }, { 8, 2, 1, 2, 1 },
+  // sid 5
+  { 0, 0, 0, 0, 0 }, { 0, 1, 0, 0, 0 }, { 12, 1, 0, 0, 0 }, { 11, 1, 0, 0, 0 },
+  { 4, 2, 1, 6, 0 }, { 0, 0, 0, 0, 0 }, { 4, 2, 0, 4, 1 },
+  // sid 6
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+};
+
+const uint16_t LwsnFixedSlotTables<6, 13, 3, false>::delays[637] = {
+  // sid 0, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 0, osid 1
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 0, osid 2
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 0, osid 3
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 0, osid 4
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 0, osid 5
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 0, osid 6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 1, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 1, osid 1
+  1, 0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  // sid 1, osid 2
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 1, osid 3
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 1, osid 4
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 1, osid 5
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 1, osid 6
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 2, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 2, osid 1
+  4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 7, 6, 5,
+  // sid 2, osid 2
+  2, 1, 0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  // sid 2, osid 3
+  4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 7, 6, 5,
+  // sid 2, osid 4
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 12,
+  // sid 2, osid 5
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  // sid 2, osid 6
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 3, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 3, osid 1
+  7, 6, 5, 4, 3, 2, 1, 0, 12, 11, 10, 9, 8,
+  // sid 3, osid 2
+  5, 4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 7, 6,
+  // sid 3, osid 3
+  3, 2, 1, 0, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+  // sid 3, osid 4
+  5, 4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 7, 6,
+  // sid 3, osid 5
+  7, 6, 5, 4, 3, 2, 1, 0, 12, 11, 10, 9, 8,
+  // sid 3, osid 6
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 12, 11, 10,
+  // sid 4, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 4, osid 1
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 12, 11,
+  // sid 4, osid 2
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 12, 11, 10, 9,
+  // sid 4, osid 3
+  6, 5, 4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 7,
+  // sid 4, osid 4
+  1, 0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  // sid 4, osid 5
+  6, 5, 4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 7,
+  // sid 4, osid 6
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 12, 11, 10, 9,
+  // sid 5, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 5, osid 1
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 5, osid 2
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  // sid 5, osid 3
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 12,
+  // sid 5, osid 4
+  4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 7, 6, 5,
+  // sid 5, osid 5
+  2, 1, 0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  // sid 5, osid 6
+  4, 3, 2, 1, 0, 12, 11, 10, 9, 8, 7, 6, 5,
+  // sid 6, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  // sid 6, osid 1
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 6, osid 2
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 6, osid 3
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 6, osid 4
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 6, osid 5
+  0, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  // sid 6, osid 6
+  3, 2, 1, 0, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+};
+
+const LwsnSlotSchedule::Entry LwsnFixedSlotTables<8, 22, 3, false>::routes[81] = {
+  // sid 0
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 },
+  // sid 1
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 },
+  // sid 2
+  { 0, 0, 0, 0, 0 }, { 4, 2, 1, 3, 0 }, { 0, 0, 0, 0, 0 }, { 4, 2, 0, 1, 1 },
+  { 8, 1, 0, 0, 0 }, { 10, 1, 0, 0, 0 }, { 18, 1, 0, 0, 0 }, { 19, 1, 0, 0, 0 },
+  { 20, 1, 0, 0, 0 },
+  // sid 3
+  { 0, 0, 0, 0, 0 }, { 7, 2, 1, 5, 0 }, { 5, 2, 0, 4, 0 }, { 0, 0, 0, 0, 0 },
+  { 5, 2, 1, 2, 1 }, { 7, 2, 0, 1, 1 }, { 15, 1, 0, 0, 0 }, { 16, 1, 0, 0, 0 },
+  { 17, 1, 0, 0, 0 },
+  // sid 4
+  { 0, 0, 0, 0, 0 }, { 11, 2, 1, 7, 0 }, { 9, 2, 1, 6, 0 }, { 6, 2, 0, 5, 0 },
+  { 0, 0, 0, 0, 0 }, { 6, 2, 1, 3, 1 }, { 9, 2, 0, 2, 1 }, { 11, 2, 0, 1, 1 },
+  { 13, 1, 0, 0, 0 },
+  // sid 5
+  { 0, 0, 0, 0, 0 }, { 14, 1, 0, 0, 0 }, { 12, 2, 0, 8, 0 }, { 10, 2, 0, 7, 0 },
+  { 8, 2, 1, 6, 0 }, { 0, 0, 0, 0, 0 }, { 8, 2, 0, 4, 1 }, { 10, 2, 1, 3, 1 },
+  { 12, 2, 1, 2, 1 },
+  // sid 6
+  { 0, 0, 0, 0, 0 }, { 18, 1, 0, 0, 0 }, { 17, 1, 0, 0, 0 }, { 16, 1, 0, 0, 0 },
+  { 15, 1, 0, 0, 0 }, { 5, 2, 0, 7, 0 }, { 0, 0, 0, 0, 0 }, { 5, 2, 1, 5, 1 },
+  { 7, 1, 0, 0, 0 },
+  // sid 7
+  { 0, 0, 0, 0, 0 }, { 0, 1, 0, 0, 0 }, { 21, 1, 0, 0, 0 }, { 20, 1, 0, 0, 0 },
+  { 19, 1, 0, 0, 0 }, { 6, 1, 0, 0, 0 }, { 4, 2, 0, 8, 0 }, { 0, 0, 0, 0, 0 },
+  { 4, 2, 1, 6, 1 },
+  // sid 8
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 },
+};
+
+const uint16_t LwsnFixedSlotTables<8, 22, 3, false>::delays[1782] = {
+  // sid 0, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 1
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 2
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 3
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 4
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 5
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 7
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 8
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 1, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 1, osid 1
+  1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2,
+  // sid 1, osid 2
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 3
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 4
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 5
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 6
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 7
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 8
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 2, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 2, osid 1
+  4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 2, osid 2
+  2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,
+  8, 7, 6, 5, 4, 3,
+  // sid 2, osid 3
+  4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 2, osid 4
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15,
+  14, 13, 12, 11, 10, 9,
+  // sid 2, osid 5
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11,
+  // sid 2, osid 6
+  18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  2, 1, 0, 21, 20, 19,
+  // sid 2, osid 7
+  19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+  3, 2, 1, 0, 21, 20,
+  // sid 2, osid 8
+  20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+  4, 3, 2, 1, 0, 21,
+  // sid 3, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 3, osid 1
+  7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8,
+  // sid 3, osid 2
+  5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 3, osid 3
+  3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+  9, 8, 7, 6, 5, 4,
+  // sid 3, osid 4
+  5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 3, osid 5
+  7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8,
+  // sid 3, osid 6
+  15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  21, 20, 19, 18, 17, 16,
+  // sid 3, osid 7
+  16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  0, 21, 20, 19, 18, 17,
+  // sid 3, osid 8
+  17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  1, 0, 21, 20, 19, 18,
+  // sid 4, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 4, osid 1
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18,
+  17, 16, 15, 14, 13, 12,
+  // sid 4, osid 2
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10,
+  // sid 4, osid 3
+  6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+  12, 11, 10, 9, 8, 7,
+  // sid 4, osid 4
+  1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2,
+  // sid 4, osid 5
+  6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+  12, 11, 10, 9, 8, 7,
+  // sid 4, osid 6
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10,
+  // sid 4, osid 7
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18,
+  17, 16, 15, 14, 13, 12,
+  // sid 4, osid 8
+  13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20,
+  19, 18, 17, 16, 15, 14,
+  // sid 5, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 5, osid 1
+  14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21,
+  20, 19, 18, 17, 16, 15,
+  // sid 5, osid 2
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19,
+  18, 17, 16, 15, 14, 13,
+  // sid 5, osid 3
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11,
+  // sid 5, osid 4
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15,
+  14, 13, 12, 11, 10, 9,
+  // sid 5, osid 5
+  2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,
+  8, 7, 6, 5, 4, 3,
+  // sid 5, osid 6
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15,
+  14, 13, 12, 11, 10, 9,
+  // sid 5, osid 7
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11,
+  // sid 5, osid 8
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19,
+  18, 17, 16, 15, 14, 13,
+  // sid 6, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 6, osid 1
+  18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  2, 1, 0, 21, 20, 19,
+  // sid 6, osid 2
+  17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  1, 0, 21, 20, 19, 18,
+  // sid 6, osid 3
+  16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  0, 21, 20, 19, 18, 17,
+  // sid 6, osid 4
+  15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  21, 20, 19, 18, 17, 16,
+  // sid 6, osid 5
+  5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 6, osid 6
+  3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+  9, 8, 7, 6, 5, 4,
+  // sid 6, osid 7
+  5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 6, osid 8
+  7, 6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8,
+  // sid 7, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 7, osid 1
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 7, osid 2
+  21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+  5, 4, 3, 2, 1, 0,
+  // sid 7, osid 3
+  20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+  4, 3, 2, 1, 0, 21,
+  // sid 7, osid 4
+  19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+  3, 2, 1, 0, 21, 20,
+  // sid 7, osid 5
+  6, 5, 4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+  12, 11, 10, 9, 8, 7,
+  // sid 7, osid 6
+  4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 7, osid 7
+  1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2,
+  // sid 7, osid 8
+  4, 3, 2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 8, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 8, osid 1
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 8, osid 2
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 8, osid 3
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 8, osid 4
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 8, osid 5
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 8, osid 6
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 8, osid 7
+  0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 8, osid 8
+  2, 1, 0, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,
+  8, 7, 6, 5, 4, 3,
+};
+
+const LwsnSlotSchedule::Entry LwsnFixedSlotTables<12, 38, 3, false>::routes[169] = {
+  // sid 0
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 },
+  // sid 1
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 },
+  // sid 2
+  { 0, 0, 0, 0, 0 }, { 4, 2, 1, 3, 0 }, { 0, 0, 0, 0, 0 }, { 4, 2, 0, 1, 1 },
+  { 9, 1, 0, 0, 0 }, { 12, 1, 0, 0, 0 }, { 14, 1, 0, 0, 0 }, { 17, 1, 0, 0, 0 },
+  { 18, 1, 0, 0, 0 }, { 35, 1, 0, 0, 0 }, { 36, 1, 0, 0, 0 }, { 37, 1, 0, 0, 0 },
+  { 0, 1, 0, 0, 0 },
+  // sid 3
+  { 0, 0, 0, 0, 0 }, { 7, 2, 1, 5, 0 }, { 5, 2, 0, 4, 0 }, { 0, 0, 0, 0, 0 },
+  { 5, 2, 1, 2, 1 }, { 7, 2, 0, 1, 1 }, { 11, 1, 0, 0, 0 }, { 15, 1, 0, 0, 0 },
+  { 16, 1, 0, 0, 0 }, { 31, 1, 0, 0, 0 }, { 32, 1, 0, 0, 0 }, { 33, 1, 0, 0, 0 },
+  { 34, 1, 0, 0, 0 },
+  // sid 4
+  { 0, 0, 0, 0, 0 }, { 10, 2, 1, 7, 0 }, { 8, 2, 0, 6, 0 }, { 6, 2, 0, 5, 0 },
+  { 0, 0, 0, 0, 0 }, { 6, 2, 1, 3, 1 }, { 8, 2, 1, 2, 1 }, { 10, 2, 0, 1, 1 },
+  { 13, 1, 0, 0, 0 }, { 27, 1, 0, 0, 0 }, { 28, 1, 0, 0, 0 }, { 29, 1, 0, 0, 0 },
+  { 30, 1, 0, 0, 0 },
+  // sid 5
+  { 0, 0, 0, 0, 0 }, { 14, 1, 0, 0, 0 }, { 12, 2, 1, 8, 0 }, { 9, 2, 0, 7, 0 },
+  { 4, 2, 1, 6, 0 }, { 0, 0, 0, 0, 0 }, { 4, 2, 0, 4, 1 }, { 9, 2, 1, 3, 1 },
+  { 12, 2, 0, 2, 1 }, { 23, 1, 0, 0, 0 }, { 24, 1, 0, 0, 0 }, { 25, 1, 0, 0, 0 },
+  { 26, 1, 0, 0, 0 },
+  // sid 6
+  { 0, 0, 0, 0, 0 }, { 19, 2, 1, 11, 0 }, { 17, 2, 1, 10, 0 }, { 15, 2, 1, 9, 0 },
+  { 11, 2, 1, 8, 0 }, { 5, 2, 0, 7, 0 }, { 0, 0, 0, 0, 0 }, { 5, 2, 1, 5, 1 },
+  { 11, 2, 0, 4, 1 }, { 15, 2, 0, 3, 1 }, { 17, 2, 0, 2, 1 }, { 19, 2, 0, 1, 1 },
+  { 21, 1, 0, 0, 0 },
+  // sid 7
+  { 0, 0, 0, 0, 0 }, { 22, 1, 0, 0, 0 }, { 20, 2, 0, 12, 0 }, { 18, 2, 0, 11, 0 },
+  { 16, 2, 0, 10, 0 }, { 13, 2, 0, 9, 0 }, { 7, 2, 0, 8, 0 }, { 0, 0, 0, 0, 0 },
+  { 7, 2, 1, 6, 1 }, { 13, 2, 1, 5, 1 }, { 16, 2, 1, 4, 1 }, { 18, 2, 1, 3, 1 },
+  { 20, 2, 1, 2, 1 },
+  // sid 8
+  { 0, 0, 0, 0, 0 }, { 26, 1, 0, 0, 0 }, { 25, 1, 0, 0, 0 }, { 24, 1, 0, 0, 0 },
+  { 23, 1, 0, 0, 0 }, { 14, 2, 0, 12, 0 }, { 9, 2, 0, 10, 0 }, { 4, 2, 1, 9, 0 },
+  { 0, 0, 0, 0, 0 }, { 4, 2, 0, 7, 1 }, { 9, 2, 1, 6, 1 }, { 12, 1, 0, 0, 0 },
+  { 14, 2, 1, 5, 1 },
+  // sid 9
+  { 0, 0, 0, 0, 0 }, { 30, 1, 0, 0, 0 }, { 29, 1, 0, 0, 0 }, { 28, 1, 0, 0, 0 },
+  { 27, 1, 0, 0, 0 }, { 15, 1, 0, 0, 0 }, { 10, 2, 0, 12, 0 }, { 8, 2, 1, 11, 0 },
+  { 6, 2, 0, 10, 0 }, { 0, 0, 0, 0, 0 }, { 6, 2, 1, 8, 1 }, { 8, 2, 0, 7, 1 },
+  { 10, 2, 1, 6, 1 },
+  // sid 10
+  { 0, 0, 0, 0, 0 }, { 34, 1, 0, 0, 0 }, { 33, 1, 0, 0, 0 }, { 32, 1, 0, 0, 0 },
+  { 31, 1, 0, 0, 0 }, { 16, 1, 0, 0, 0 }, { 13, 1, 0, 0, 0 }, { 11, 1, 0, 0, 0 },
+  { 7, 2, 0, 12, 0 }, { 5, 2, 0, 11, 0 }, { 0, 0, 0, 0, 0 }, { 5, 2, 1, 9, 1 },
+  { 7, 2, 1, 8, 1 },
+  // sid 11
+  { 0, 0, 0, 0, 0 }, { 0, 1, 0, 0, 0 }, { 37, 1, 0, 0, 0 }, { 36, 1, 0, 0, 0 },
+  { 35, 1, 0, 0, 0 }, { 18, 1, 0, 0, 0 }, { 17, 1, 0, 0, 0 }, { 14, 1, 0, 0, 0 },
+  { 12, 1, 0, 0, 0 }, { 9, 1, 0, 0, 0 }, { 4, 2, 1, 12, 0 }, { 0, 0, 0, 0, 0 },
+  { 4, 2, 0, 10, 1 },
+  // sid 12
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 }, { 0, 0, 0, 0, 0 },
+  { 0, 0, 0, 0, 0 },
+};
+
+const uint16_t LwsnFixedSlotTables<12, 38, 3, false>::delays[6422] = {
+  // sid 0, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 1
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 2
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 3
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 4
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 5
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 6
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 7
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 8
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 9
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 10
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 11
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 0, osid 12
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 1, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 1, osid 1
+  1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24,
+  23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2,
+  // sid 1, osid 2
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 3
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 4
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 5
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 6
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 7
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 8
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 9
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 10
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 11
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 1, osid 12
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 2, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 2, osid 1
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 2, osid 2
+  2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,
+  24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,
+  8, 7, 6, 5, 4, 3,
+  // sid 2, osid 3
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 2, osid 4
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32,
+  31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10,
+  // sid 2, osid 5
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35,
+  34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19,
+  18, 17, 16, 15, 14, 13,
+  // sid 2, osid 6
+  14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37,
+  36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21,
+  20, 19, 18, 17, 16, 15,
+  // sid 2, osid 7
+  17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24,
+  23, 22, 21, 20, 19, 18,
+  // sid 2, osid 8
+  18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,
+  24, 23, 22, 21, 20, 19,
+  // sid 2, osid 9
+  35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20,
+  19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+  3, 2, 1, 0, 37, 36,
+  // sid 2, osid 10
+  36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21,
+  20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+  4, 3, 2, 1, 0, 37,
+  // sid 2, osid 11
+  37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22,
+  21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+  5, 4, 3, 2, 1, 0,
+  // sid 2, osid 12
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 3, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 3, osid 1
+  7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30,
+  29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8,
+  // sid 3, osid 2
+  5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28,
+  27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 3, osid 3
+  3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26,
+  25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+  9, 8, 7, 6, 5, 4,
+  // sid 3, osid 4
+  5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28,
+  27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 3, osid 5
+  7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30,
+  29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8,
+  // sid 3, osid 6
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34,
+  33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18,
+  17, 16, 15, 14, 13, 12,
+  // sid 3, osid 7
+  15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22,
+  21, 20, 19, 18, 17, 16,
+  // sid 3, osid 8
+  16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17,
+  // sid 3, osid 9
+  31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  37, 36, 35, 34, 33, 32,
+  // sid 3, osid 10
+  32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  0, 37, 36, 35, 34, 33,
+  // sid 3, osid 11
+  33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18,
+  17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  1, 0, 37, 36, 35, 34,
+  // sid 3, osid 12
+  34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19,
+  18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  2, 1, 0, 37, 36, 35,
+  // sid 4, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 4, osid 1
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33,
+  32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11,
+  // sid 4, osid 2
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31,
+  30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15,
+  14, 13, 12, 11, 10, 9,
+  // sid 4, osid 3
+  6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29,
+  28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+  12, 11, 10, 9, 8, 7,
+  // sid 4, osid 4
+  1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24,
+  23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2,
+  // sid 4, osid 5
+  6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29,
+  28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+  12, 11, 10, 9, 8, 7,
+  // sid 4, osid 6
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31,
+  30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15,
+  14, 13, 12, 11, 10, 9,
+  // sid 4, osid 7
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33,
+  32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11,
+  // sid 4, osid 8
+  13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36,
+  35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20,
+  19, 18, 17, 16, 15, 14,
+  // sid 4, osid 9
+  27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34,
+  33, 32, 31, 30, 29, 28,
+  // sid 4, osid 10
+  28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35,
+  34, 33, 32, 31, 30, 29,
+  // sid 4, osid 11
+  29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36,
+  35, 34, 33, 32, 31, 30,
+  // sid 4, osid 12
+  30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15,
+  14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37,
+  36, 35, 34, 33, 32, 31,
+  // sid 5, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 5, osid 1
+  14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37,
+  36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21,
+  20, 19, 18, 17, 16, 15,
+  // sid 5, osid 2
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35,
+  34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19,
+  18, 17, 16, 15, 14, 13,
+  // sid 5, osid 3
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32,
+  31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10,
+  // sid 5, osid 4
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 5, osid 5
+  2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,
+  24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,
+  8, 7, 6, 5, 4, 3,
+  // sid 5, osid 6
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 5, osid 7
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32,
+  31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10,
+  // sid 5, osid 8
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35,
+  34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19,
+  18, 17, 16, 15, 14, 13,
+  // sid 5, osid 9
+  23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30,
+  29, 28, 27, 26, 25, 24,
+  // sid 5, osid 10
+  24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31,
+  30, 29, 28, 27, 26, 25,
+  // sid 5, osid 11
+  25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32,
+  31, 30, 29, 28, 27, 26,
+  // sid 5, osid 12
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33,
+  32, 31, 30, 29, 28, 27,
+  // sid 6, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 6, osid 1
+  19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+  3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26,
+  25, 24, 23, 22, 21, 20,
+  // sid 6, osid 2
+  17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24,
+  23, 22, 21, 20, 19, 18,
+  // sid 6, osid 3
+  15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22,
+  21, 20, 19, 18, 17, 16,
+  // sid 6, osid 4
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34,
+  33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18,
+  17, 16, 15, 14, 13, 12,
+  // sid 6, osid 5
+  5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28,
+  27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 6, osid 6
+  3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26,
+  25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+  9, 8, 7, 6, 5, 4,
+  // sid 6, osid 7
+  5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28,
+  27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 6, osid 8
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34,
+  33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18,
+  17, 16, 15, 14, 13, 12,
+  // sid 6, osid 9
+  15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22,
+  21, 20, 19, 18, 17, 16,
+  // sid 6, osid 10
+  17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24,
+  23, 22, 21, 20, 19, 18,
+  // sid 6, osid 11
+  19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+  3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26,
+  25, 24, 23, 22, 21, 20,
+  // sid 6, osid 12
+  21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+  5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28,
+  27, 26, 25, 24, 23, 22,
+  // sid 7, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 7, osid 1
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29,
+  28, 27, 26, 25, 24, 23,
+  // sid 7, osid 2
+  20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21,
+  // sid 7, osid 3
+  18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,
+  24, 23, 22, 21, 20, 19,
+  // sid 7, osid 4
+  16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17,
+  // sid 7, osid 5
+  13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36,
+  35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20,
+  19, 18, 17, 16, 15, 14,
+  // sid 7, osid 6
+  7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30,
+  29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8,
+  // sid 7, osid 7
+  1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24,
+  23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2,
+  // sid 7, osid 8
+  7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30,
+  29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8,
+  // sid 7, osid 9
+  13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36,
+  35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20,
+  19, 18, 17, 16, 15, 14,
+  // sid 7, osid 10
+  16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17,
+  // sid 7, osid 11
+  18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,
+  24, 23, 22, 21, 20, 19,
+  // sid 7, osid 12
+  20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21,
+  // sid 8, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 8, osid 1
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33,
+  32, 31, 30, 29, 28, 27,
+  // sid 8, osid 2
+  25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32,
+  31, 30, 29, 28, 27, 26,
+  // sid 8, osid 3
+  24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31,
+  30, 29, 28, 27, 26, 25,
+  // sid 8, osid 4
+  23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30,
+  29, 28, 27, 26, 25, 24,
+  // sid 8, osid 5
+  14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37,
+  36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21,
+  20, 19, 18, 17, 16, 15,
+  // sid 8, osid 6
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32,
+  31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10,
+  // sid 8, osid 7
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 8, osid 8
+  2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,
+  24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,
+  8, 7, 6, 5, 4, 3,
+  // sid 8, osid 9
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 8, osid 10
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32,
+  31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10,
+  // sid 8, osid 11
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35,
+  34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19,
+  18, 17, 16, 15, 14, 13,
+  // sid 8, osid 12
+  14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37,
+  36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21,
+  20, 19, 18, 17, 16, 15,
+  // sid 9, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 9, osid 1
+  30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15,
+  14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37,
+  36, 35, 34, 33, 32, 31,
+  // sid 9, osid 2
+  29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36,
+  35, 34, 33, 32, 31, 30,
+  // sid 9, osid 3
+  28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35,
+  34, 33, 32, 31, 30, 29,
+  // sid 9, osid 4
+  27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34,
+  33, 32, 31, 30, 29, 28,
+  // sid 9, osid 5
+  15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22,
+  21, 20, 19, 18, 17, 16,
+  // sid 9, osid 6
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33,
+  32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11,
+  // sid 9, osid 7
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31,
+  30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15,
+  14, 13, 12, 11, 10, 9,
+  // sid 9, osid 8
+  6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29,
+  28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+  12, 11, 10, 9, 8, 7,
+  // sid 9, osid 9
+  3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26,
+  25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+  9, 8, 7, 6, 5, 4,
+  // sid 9, osid 10
+  6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29,
+  28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13,
+  12, 11, 10, 9, 8, 7,
+  // sid 9, osid 11
+  8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31,
+  30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15,
+  14, 13, 12, 11, 10, 9,
+  // sid 9, osid 12
+  10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33,
+  32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11,
+  // sid 10, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 10, osid 1
+  34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19,
+  18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  2, 1, 0, 37, 36, 35,
+  // sid 10, osid 2
+  33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18,
+  17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  1, 0, 37, 36, 35, 34,
+  // sid 10, osid 3
+  32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17,
+  16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  0, 37, 36, 35, 34, 33,
+  // sid 10, osid 4
+  31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0,
+  37, 36, 35, 34, 33, 32,
+  // sid 10, osid 5
+  16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1,
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17,
+  // sid 10, osid 6
+  13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36,
+  35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20,
+  19, 18, 17, 16, 15, 14,
+  // sid 10, osid 7
+  11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34,
+  33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18,
+  17, 16, 15, 14, 13, 12,
+  // sid 10, osid 8
+  7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30,
+  29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8,
+  // sid 10, osid 9
+  5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28,
+  27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 10, osid 10
+  1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24,
+  23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8,
+  7, 6, 5, 4, 3, 2,
+  // sid 10, osid 11
+  5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28,
+  27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12,
+  11, 10, 9, 8, 7, 6,
+  // sid 10, osid 12
+  7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30,
+  29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14,
+  13, 12, 11, 10, 9, 8,
+  // sid 11, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 11, osid 1
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 11, osid 2
+  37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22,
+  21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6,
+  5, 4, 3, 2, 1, 0,
+  // sid 11, osid 3
+  36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21,
+  20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5,
+  4, 3, 2, 1, 0, 37,
+  // sid 11, osid 4
+  35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20,
+  19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4,
+  3, 2, 1, 0, 37, 36,
+  // sid 11, osid 5
+  18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3,
+  2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,
+  24, 23, 22, 21, 20, 19,
+  // sid 11, osid 6
+  17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2,
+  1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24,
+  23, 22, 21, 20, 19, 18,
+  // sid 11, osid 7
+  14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37,
+  36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21,
+  20, 19, 18, 17, 16, 15,
+  // sid 11, osid 8
+  12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35,
+  34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19,
+  18, 17, 16, 15, 14, 13,
+  // sid 11, osid 9
+  9, 8, 7, 6, 5, 4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32,
+  31, 30, 29, 28, 27, 26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16,
+  15, 14, 13, 12, 11, 10,
+  // sid 11, osid 10
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 11, osid 11
+  2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25,
+  24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9,
+  8, 7, 6, 5, 4, 3,
+  // sid 11, osid 12
+  4, 3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27,
+  26, 25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11,
+  10, 9, 8, 7, 6, 5,
+  // sid 12, osid 0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0,
+  0, 0, 0, 0, 0, 0,
+  // sid 12, osid 1
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 2
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 3
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 4
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 5
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 6
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 7
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 8
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 9
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 10
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 11
+  0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26, 25, 24, 23,
+  22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10, 9, 8, 7,
+  6, 5, 4, 3, 2, 1,
+  // sid 12, osid 12
+  3, 2, 1, 0, 37, 36, 35, 34, 33, 32, 31, 30, 29, 28, 27, 26,
+  25, 24, 23, 22, 21, 20, 19, 18, 17, 16, 15, 14, 13, 12, 11, 10,
+  9, 8, 7, 6, 5, 4,
+};
+
+} // namespace ns3
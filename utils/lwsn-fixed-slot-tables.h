@@ -0,0 +1,72 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+
+// Generated by scratch/lwsn-fixed-tables.cc; do not edit.
+
+#ifndef LWSN_FIXED_SLOT_TABLES_H
+#define LWSN_FIXED_SLOT_TABLES_H
+
+#include <stdint.h>
+
+#include "lwsn-slot-schedule.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Routes and delays of LwsnFixedSlotSchedule for one chain shape.
+ *
+ * Only the shapes specialized below exist; any other shape fails to
+ * compile.  routes has (NNodes + 1)^2 entries, indexed
+ * sid * (NNodes + 1) + osid, and delays FrameLength entries for each of
+ * those, by slot of the frame.
+ *
+ * \tparam NNodes number of sids in the chain
+ * \tparam FrameLength slots per frame
+ * \tparam ReuseDistance hops between two transmitters of one slot
+ * \tparam Pipelined value of the Pipelined attribute
+ */
+template <uint16_t NNodes, uint16_t FrameLength, uint16_t ReuseDistance, bool Pipelined>
+struct LwsnFixedSlotTables;
+
+/// Tables of 6 sids, 13 slots, reuse distance 3.
+template <>
+struct LwsnFixedSlotTables<6, 13, 3, false>
+{
+  static const LwsnSlotSchedule::Entry routes[49]; //!< route per (sid, osid)
+  static const uint16_t delays[637]; //!< delay per (sid, osid, slot)
+};
+
+/// Tables of 8 sids, 22 slots, reuse distance 3.
+template <>
+struct LwsnFixedSlotTables<8, 22, 3, false>
+{
+  static const LwsnSlotSchedule::Entry routes[81]; //!< route per (sid, osid)
+  static const uint16_t delays[1782]; //!< delay per (sid, osid, slot)
+};
+
+/// Tables of 12 sids, 38 slots, reuse distance 3.
+template <>
+struct LwsnFixedSlotTables<12, 38, 3, false>
+{
+  static const LwsnSlotSchedule::Entry routes[169]; //!< route per (sid, osid)
+  static const uint16_t delays[6422]; //!< delay per (sid, osid, slot)
+};
+
+} // namespace ns3
+
+#endif /* LWSN_FIXED_SLOT_TABLES_H */
@@ -0,0 +1,181 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lwsn-frame-header.h"
+#include "ns3/abort.h"
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (LwsnFrameHeader);
+
+namespace {
+
+/// Wire format shared by all frame headers.
+LwsnFrameHeader::Format g_format = LwsnFrameHeader::COMPAT;
+
+/// Sids must stay below this in COMPACT format.
+const uint16_t g_sidLimit = 1 << 12;
+
+} // anonymous namespace
+
+TypeId
+LwsnFrameHeader::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LwsnFrameHeader")
+    .SetParent<LwsnHeader> ()
+    .SetGroupName ("Network")
+    .AddConstructor<LwsnFrameHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+LwsnFrameHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+LwsnFrameHeader::LwsnFrameHeader ()
+  : m_slot (0)
+{
+}
+
+void
+LwsnFrameHeader::SetFormat (Format format)
+{
+  g_format = format;
+}
+
+LwsnFrameHeader::Format
+LwsnFrameHeader::GetFormat (void)
+{
+  return g_format;
+}
+
+void
+LwsnFrameHeader::SetSlot (uint64_t slot)
+{
+  m_slot = slot & 0xfffff;
+}
+
+uint32_t
+LwsnFrameHeader::GetSlot (void) const
+{
+  return m_slot;
+}
+
+bool
+LwsnFrameHeader::HasOsid2 (void) const
+{
+  // sids start at 1, so 0 means no second flow
+  return GetType () == LwsnHeader::NETWORK_CODING && GetOsid2 () != 0;
+}
+
+void
+LwsnFrameHeader::Print (std::ostream &os) const
+{
+  LwsnHeader::Print (os);
+  if (g_format == COMPACT)
+    {
+      os << " slot=" << m_slot;
+    }
+}
+
+uint32_t
+LwsnFrameHeader::GetSerializedSize (void) const
+{
+  if (g_format == COMPAT)
+    {
+      return LwsnHeader::GetSerializedSize ();
+    }
+  return HasOsid2 () ? 8 : 6;
+}
+
+void
+LwsnFrameHeader::Serialize (Buffer::Iterator start) const
+{
+  if (g_format == COMPAT)
+    {
+      LwsnHeader::Serialize (start);
+      return;
+    }
+  NS_ABORT_MSG_IF (GetPsid () >= g_sidLimit || GetOsid () >= g_sidLimit || GetOsid2 () >= g_sidLimit,
+                   "compact LwsnFrameHeader needs sids below " << g_sidLimit);
+  uint64_t type = 0;
+  if (GetType () == LwsnHeader::FORWARDING)
+    {
+      type = 1;
+    }
+  else if (GetType () == LwsnHeader::NETWORK_CODING)
+    {
+      type = 2;
+    }
+  bool osid2 = HasOsid2 ();
+  uint64_t word = (type << 46)
+    | ((uint64_t)(GetE () != 0) << 45)
+    | ((uint64_t)osid2 << 44)
+    | ((uint64_t)GetPsid () << 32)
+    | ((uint64_t)GetOsid () << 20)
+    | m_slot;
+  for (int shift = 40; shift >= 0; shift -= 8)
+    {
+      start.WriteU8 ((word >> shift) & 0xff);
+    }
+  if (osid2)
+    {
+      start.WriteHtonU16 (GetOsid2 () << 4);
+    }
+}
+
+uint32_t
+LwsnFrameHeader::Deserialize (Buffer::Iterator start)
+{
+  if (g_format == COMPAT)
+    {
+      m_slot = 0;
+      return LwsnHeader::Deserialize (start);
+    }
+  uint64_t word = 0;
+  for (int i = 0; i < 6; ++i)
+    {
+      word = (word << 8) | start.ReadU8 ();
+    }
+  switch ((word >> 46) & 0x3)
+    {
+    case 1:
+      SetType (LwsnHeader::FORWARDING);
+      break;
+    case 2:
+      SetType (LwsnHeader::NETWORK_CODING);
+      break;
+    default:
+      SetType (LwsnHeader::ORIGINAL_TRANSMISSION);
+      break;
+    }
+  SetE ((word >> 45) & 0x1);
+  SetPsid ((word >> 32) & 0xfff);
+  SetOsid ((word >> 20) & 0xfff);
+  m_slot = word & 0xfffff;
+  SetR (0);
+  SetOsid2 (0);
+  if ((word >> 44) & 0x1)
+    {
+      SetOsid2 (start.ReadNtohU16 () >> 4);
+      return 8;
+    }
+  return 6;
+}
+
+} // namespace ns3
@@ -0,0 +1,100 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_FRAME_HEADER_H
+#define LWSN_FRAME_HEADER_H
+
+#include <stdint.h>
+
+#include "ns3/network-module.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief LwsnHeader with a choice of wire format.
+ *
+ * The COMPAT format is the LwsnHeader layout, with R as a double.  The
+ * COMPACT format packs the fields into 6 bytes for chains of fewer than
+ * 4096 nodes:
+ *
+ *   type (2 bits) | E (1) | Osid2 present (1) | Psid (12) | Osid (12) |
+ *   slot stamp (20)
+ *
+ * followed, on a coded frame that names a second flow, by that Osid2
+ * in 12 more bits and 4 bits of padding.  A coded frame thus carries
+ * one Osid per flow it codes: RLNC frames one, XOR pairs two.  The slot
+ * stamp, the slot clock modulo 2^20, replaces R, which the compact
+ * format does not carry.  E is sent as a single bit.
+ *
+ * The format is a property of the whole simulation, since every device
+ * has to parse what its neighbors send; set it before the first frame.
+ */
+class LwsnFrameHeader : public LwsnHeader
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  LwsnFrameHeader ();
+
+  /// Wire format of every LwsnFrameHeader.
+  enum Format
+  {
+    COMPAT = 0,   //!< the LwsnHeader layout
+    COMPACT       //!< bit-packed, with a slot stamp instead of R
+  };
+
+  /**
+   * \param format wire format of all frame headers from now on
+   */
+  static void SetFormat (Format format);
+  /**
+   * \return the wire format of the frame headers
+   */
+  static Format GetFormat (void);
+
+  /**
+   * \param slot slot clock at which the reading was taken; only its
+   *        low 20 bits are kept
+   */
+  void SetSlot (uint64_t slot);
+  /**
+   * \return the slot stamp; 0 if the header was read in COMPAT format
+   */
+  uint32_t GetSlot (void) const;
+
+  virtual void Print (std::ostream &os) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+private:
+  /**
+   * \return true if COMPACT carries Osid2
+   */
+  bool HasOsid2 (void) const;
+
+  uint32_t m_slot; //!< slot stamp, 20 bits
+};
+
+} // namespace ns3
+
+#endif /* LWSN_FRAME_HEADER_H */
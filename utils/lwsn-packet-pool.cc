@@ -0,0 +1,176 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include <algorithm>
+
+#include "lwsn-packet-pool.h"
+#include "ns3/header.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LwsnPacketPool");
+
+namespace {
+
+/**
+ * Writes raw payload bytes into a recycled packet through AddHeader,
+ * which reuses the packet's buffer when it is not shared.
+ */
+class PoolPayload : public Header
+{
+public:
+  PoolPayload (const uint8_t *data, uint32_t size)
+    : m_data (data),
+      m_size (size)
+  {
+  }
+  static TypeId GetTypeId (void)
+  {
+    static TypeId tid = TypeId ("ns3::LwsnPoolPayload")
+      .SetParent<Header> ()
+      .SetGroupName ("Network")
+    ;
+    return tid;
+  }
+  virtual TypeId GetInstanceTypeId (void) const
+  {
+    return GetTypeId ();
+  }
+  virtual uint32_t GetSerializedSize (void) const
+  {
+    return m_size;
+  }
+  virtual void Serialize (Buffer::Iterator start) const
+  {
+    start.Write (m_data, m_size);
+  }
+  virtual uint32_t Deserialize (Buffer::Iterator start)
+  {
+    return m_size;
+  }
+  virtual void Print (std::ostream &os) const
+  {
+    os << "size=" << m_size;
+  }
+
+private:
+  const uint8_t *m_data; //!< payload bytes
+  uint32_t m_size;       //!< payload size
+};
+
+/// Pooled packets checked per Acquire before a new one is created.
+const uint32_t g_scan = 4;
+
+} // anonymous namespace
+
+LwsnPacketPool &
+LwsnPacketPool::Get (void)
+{
+  static LwsnPacketPool pool;
+  return pool;
+}
+
+LwsnPacketPool::LwsnPacketPool ()
+  : m_next (0),
+    m_maxSize (4096),
+    m_hits (0),
+    m_misses (0),
+    m_highWater (0),
+    m_destroyScheduled (false)
+{
+}
+
+Ptr<Packet>
+LwsnPacketPool::Acquire (const uint8_t *data, uint32_t size)
+{
+  if (!m_destroyScheduled)
+    {
+      Simulator::ScheduleDestroy (&LwsnPacketPool::Clear, this);
+      m_destroyScheduled = true;
+    }
+
+  uint32_t scan = std::min<uint32_t> (g_scan, m_packets.size ());
+  for (uint32_t i = 0; i < scan; ++i)
+    {
+      if (m_next >= m_packets.size ())
+        {
+          m_next = 0;
+        }
+      Ptr<Packet> p = m_packets[m_next++];
+      // the pool's reference and p
+      if (p->GetReferenceCount () == 2)
+        {
+          p->RemoveAtStart (p->GetSize ());
+          p->RemoveAllPacketTags ();
+          p->RemoveAllByteTags ();
+          p->AddHeader (PoolPayload (data, size));
+          ++m_hits;
+          return p;
+        }
+    }
+
+  ++m_misses;
+  Ptr<Packet> p = Create<Packet> (data, size);
+  if (m_packets.size () < m_maxSize)
+    {
+      m_packets.push_back (p);
+      m_highWater = std::max<uint32_t> (m_highWater, m_packets.size ());
+    }
+  return p;
+}
+
+void
+LwsnPacketPool::SetMaxSize (uint32_t maxSize)
+{
+  m_maxSize = maxSize;
+  if (m_packets.size () > maxSize)
+    {
+      m_packets.resize (maxSize);
+    }
+}
+
+uint64_t
+LwsnPacketPool::GetHits (void) const
+{
+  return m_hits;
+}
+
+uint64_t
+LwsnPacketPool::GetMisses (void) const
+{
+  return m_misses;
+}
+
+uint32_t
+LwsnPacketPool::GetHighWater (void) const
+{
+  return m_highWater;
+}
+
+void
+LwsnPacketPool::Clear (void)
+{
+  NS_LOG_FUNCTION (this << m_hits << m_misses << m_highWater);
+  m_packets.clear ();
+  m_next = 0;
+  m_hits = 0;
+  m_misses = 0;
+  m_highWater = 0;
+  m_destroyScheduled = false;
+}
+
+} // namespace ns3
@@ -0,0 +1,91 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_PACKET_POOL_H
+#define LWSN_PACKET_POOL_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "ns3/packet.h"
+#include "ns3/ptr.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Per-simulation pool of packets for the coding and forwarding
+ * paths of the linear WSN devices.
+ *
+ * The pool keeps a reference to every packet it handed out.  A packet
+ * whose only remaining reference is the pool's is free again: Acquire
+ * empties it and writes the new payload into its existing buffer, so a
+ * steady flow of coded packets reuses the same Packet objects and
+ * buffers instead of allocating new ones.  Acquire checks a few pooled
+ * packets round-robin and creates a new one only if none is free; the
+ * pool stops growing at its maximum size.  A recycled packet keeps its
+ * uid.
+ *
+ * The pool is emptied and its counters reset when the simulator is
+ * destroyed; read them before Simulator::Destroy.
+ */
+class LwsnPacketPool
+{
+public:
+  /**
+   * \return the pool of the running simulation
+   */
+  static LwsnPacketPool &Get (void);
+
+  /**
+   * \param data payload bytes
+   * \param size payload size in bytes
+   * \return a packet holding a copy of the payload and nothing else
+   */
+  Ptr<Packet> Acquire (const uint8_t *data, uint32_t size);
+
+  /**
+   * \param maxSize number of packets the pool may keep, default 4096
+   */
+  void SetMaxSize (uint32_t maxSize);
+
+  /// \return Acquire calls served with a pooled packet
+  uint64_t GetHits (void) const;
+  /// \return Acquire calls that had to create a packet
+  uint64_t GetMisses (void) const;
+  /// \return the largest number of packets the pool held
+  uint32_t GetHighWater (void) const;
+
+  /**
+   * Drop all pooled packets and reset the counters.
+   */
+  void Clear (void);
+
+private:
+  LwsnPacketPool ();
+
+  std::vector<Ptr<Packet> > m_packets; //!< every packet the pool handed out
+  uint32_t m_next;                     //!< next packet checked for reuse
+  uint32_t m_maxSize;                  //!< limit on m_packets
+  uint64_t m_hits;                     //!< Acquire calls served from the pool
+  uint64_t m_misses;                   //!< Acquire calls that created a packet
+  uint32_t m_highWater;                //!< largest size of m_packets
+  bool m_destroyScheduled;             //!< Clear registered with the simulator
+};
+
+} // namespace ns3
+
+#endif /* LWSN_PACKET_POOL_H */
@@ -0,0 +1,88 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lwsn-reading-header.h"
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (LwsnReadingHeader);
+
+TypeId
+LwsnReadingHeader::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LwsnReadingHeader")
+    .SetParent<Header> ()
+    .SetGroupName ("Network")
+    .AddConstructor<LwsnReadingHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+LwsnReadingHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+LwsnReadingHeader::LwsnReadingHeader ()
+  : m_seq (0)
+{
+}
+
+void
+LwsnReadingHeader::Print (std::ostream &os) const
+{
+  os << "seq=" << m_seq;
+}
+
+uint32_t
+LwsnReadingHeader::GetSerializedSize (void) const
+{
+  return 4;
+}
+
+void
+LwsnReadingHeader::Serialize (Buffer::Iterator start) const
+{
+  start.WriteHtonU32 (m_seq);
+}
+
+uint32_t
+LwsnReadingHeader::Deserialize (Buffer::Iterator start)
+{
+  m_seq = start.ReadNtohU32 ();
+  return GetSerializedSize ();
+}
+
+void
+LwsnReadingHeader::SetSequence (uint32_t seq)
+{
+  m_seq = seq;
+}
+
+uint32_t
+LwsnReadingHeader::GetSequence (void) const
+{
+  return m_seq;
+}
+
+uint32_t
+LwsnReadingHeader::PeekSequence (const uint8_t *payload)
+{
+  return (uint32_t (payload[0]) << 24) | (uint32_t (payload[1]) << 16)
+         | (uint32_t (payload[2]) << 8) | payload[3];
+}
+
+} // namespace ns3
@@ -0,0 +1,76 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_READING_HEADER_H
+#define LWSN_READING_HEADER_H
+
+#include <stdint.h>
+
+#include "ns3/header.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief First bytes of the payload of a sensor reading: the sequence
+ * number the origin gave it.
+ *
+ * The header sits right behind the LwsnHeader that carries the origin
+ * sid, so the pair (Osid, sequence) names a reading.  Relays treat it as
+ * payload: it is coded, forwarded and decoded with the rest of the
+ * reading and arrives unchanged at the sinks.
+ */
+class LwsnReadingHeader : public Header
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  LwsnReadingHeader ();
+
+  virtual void Print (std::ostream &os) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+  /**
+   * \param seq sequence number of the reading at its origin
+   */
+  void SetSequence (uint32_t seq);
+  /**
+   * \return the sequence number of the reading at its origin
+   */
+  uint32_t GetSequence (void) const;
+
+  /**
+   * Read the sequence number from serialized payload bytes.
+   *
+   * \param payload the first GetSerializedSize () bytes of a payload
+   * \return the sequence number they hold
+   */
+  static uint32_t PeekSequence (const uint8_t *payload);
+
+private:
+  uint32_t m_seq; //!< sequence number at the origin
+};
+
+} // namespace ns3
+
+#endif /* LWSN_READING_HEADER_H */
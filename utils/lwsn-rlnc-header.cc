@@ -0,0 +1,113 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lwsn-rlnc-header.h"
+
+namespace ns3 {
+
+NS_OBJECT_ENSURE_REGISTERED (LwsnRlncHeader);
+
+TypeId
+LwsnRlncHeader::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LwsnRlncHeader")
+    .SetParent<Header> ()
+    .SetGroupName ("Network")
+    .AddConstructor<LwsnRlncHeader> ()
+  ;
+  return tid;
+}
+
+TypeId
+LwsnRlncHeader::GetInstanceTypeId (void) const
+{
+  return GetTypeId ();
+}
+
+LwsnRlncHeader::LwsnRlncHeader ()
+  : m_generation (0)
+{
+}
+
+void
+LwsnRlncHeader::Print (std::ostream &os) const
+{
+  os << "generation=" << m_generation << " coeffs=";
+  for (uint32_t i = 0; i < m_coeffs.size (); ++i)
+    {
+      os << (i ? "," : "") << (uint32_t)m_coeffs[i];
+    }
+}
+
+uint32_t
+LwsnRlncHeader::GetSerializedSize (void) const
+{
+  return 4 + 1 + m_coeffs.size ();
+}
+
+void
+LwsnRlncHeader::Serialize (Buffer::Iterator start) const
+{
+  start.WriteHtonU32 (m_generation);
+  start.WriteU8 (m_coeffs.size ());
+  if (!m_coeffs.empty ())
+    {
+      start.Write (&m_coeffs[0], m_coeffs.size ());
+    }
+}
+
+uint32_t
+LwsnRlncHeader::Deserialize (Buffer::Iterator start)
+{
+  m_generation = start.ReadNtohU32 ();
+  m_coeffs.resize (start.ReadU8 ());
+  if (!m_coeffs.empty ())
+    {
+      start.Read (&m_coeffs[0], m_coeffs.size ());
+    }
+  return GetSerializedSize ();
+}
+
+void
+LwsnRlncHeader::SetGeneration (uint32_t generation)
+{
+  m_generation = generation;
+}
+
+uint32_t
+LwsnRlncHeader::GetGeneration (void) const
+{
+  return m_generation;
+}
+
+void
+LwsnRlncHeader::SetCoefficients (const uint8_t *coeffs, uint8_t k)
+{
+  m_coeffs.assign (coeffs, coeffs + k);
+}
+
+const uint8_t *
+LwsnRlncHeader::GetCoefficients (void) const
+{
+  return m_coeffs.empty () ? 0 : &m_coeffs[0];
+}
+
+uint8_t
+LwsnRlncHeader::GetK (void) const
+{
+  return m_coeffs.size ();
+}
+
+} // namespace ns3
@@ -0,0 +1,79 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_RLNC_HEADER_H
+#define LWSN_RLNC_HEADER_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "ns3/header.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Header of a random linear network coding packet: the generation
+ * it belongs to and the coding coefficients of its payload.
+ */
+class LwsnRlncHeader : public Header
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  virtual TypeId GetInstanceTypeId (void) const;
+
+  LwsnRlncHeader ();
+
+  virtual void Print (std::ostream &os) const;
+  virtual uint32_t GetSerializedSize (void) const;
+  virtual void Serialize (Buffer::Iterator start) const;
+  virtual uint32_t Deserialize (Buffer::Iterator start);
+
+  /**
+   * \param generation generation identifier
+   */
+  void SetGeneration (uint32_t generation);
+  /**
+   * \return the generation identifier
+   */
+  uint32_t GetGeneration (void) const;
+
+  /**
+   * \param coeffs coding coefficients, one per source of the generation
+   * \param k number of coefficients
+   */
+  void SetCoefficients (const uint8_t *coeffs, uint8_t k);
+  /**
+   * \return the coding coefficients
+   */
+  const uint8_t *GetCoefficients (void) const;
+  /**
+   * \return the number of sources in the generation
+   */
+  uint8_t GetK (void) const;
+
+private:
+  uint32_t m_generation;          //!< generation identifier
+  std::vector<uint8_t> m_coeffs;  //!< coding coefficients
+};
+
+} // namespace ns3
+
+#endif /* LWSN_RLNC_HEADER_H */
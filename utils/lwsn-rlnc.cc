@@ -0,0 +1,155 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include <cstring>
+
+#include "lwsn-rlnc.h"
+#include "lwsn-coding.h"
+#include "ns3/assert.h"
+
+namespace ns3 {
+
+LwsnRlncGeneration::LwsnRlncGeneration (uint8_t k, uint32_t symbolSize)
+  : m_k (k),
+    m_symbolSize (symbolSize),
+    m_rowSize (k + symbolSize),
+    m_rank (0),
+    m_rows ((uint32_t)k * (k + symbolSize), 0),
+    m_present (k, false),
+    m_work (k + symbolSize, 0)
+{
+  NS_ASSERT (k > 0);
+}
+
+bool
+LwsnRlncGeneration::Add (const uint8_t *coeffs, const uint8_t *symbol)
+{
+  std::memcpy (&m_work[0], coeffs, m_k);
+  std::memcpy (&m_work[m_k], symbol, m_symbolSize);
+  return Eliminate ();
+}
+
+bool
+LwsnRlncGeneration::AddSource (uint8_t index, const uint8_t *symbol)
+{
+  NS_ASSERT (index < m_k);
+  std::memset (&m_work[0], 0, m_k);
+  m_work[index] = 1;
+  std::memcpy (&m_work[m_k], symbol, m_symbolSize);
+  return Eliminate ();
+}
+
+bool
+LwsnRlncGeneration::Eliminate (void)
+{
+  if (m_rank == m_k)
+    {
+      return false;
+    }
+  uint8_t *work = &m_work[0];
+  for (uint8_t p = 0; p < m_k; ++p)
+    {
+      if (m_present[p] && work[p] != 0)
+        {
+          LwsnCoding::GfMulAdd (work, &m_rows[p * m_rowSize], work[p], m_rowSize);
+        }
+    }
+  uint8_t pivot = 0;
+  while (pivot < m_k && work[pivot] == 0)
+    {
+      ++pivot;
+    }
+  if (pivot == m_k)
+    {
+      return false;
+    }
+  LwsnCoding::GfScale (work, LwsnCoding::GfInv (work[pivot]), m_rowSize);
+
+  // Keep the stored rows fully reduced so that a complete generation is
+  // already decoded.
+  for (uint8_t r = 0; r < m_k; ++r)
+    {
+      uint8_t *row = &m_rows[r * m_rowSize];
+      if (m_present[r] && row[pivot] != 0)
+        {
+          LwsnCoding::GfMulAdd (row, work, row[pivot], m_rowSize);
+        }
+    }
+  std::memcpy (&m_rows[pivot * m_rowSize], work, m_rowSize);
+  m_present[pivot] = true;
+  ++m_rank;
+  return true;
+}
+
+void
+LwsnRlncGeneration::Recode (const uint8_t *random, uint8_t *coeffs, uint8_t *symbol) const
+{
+  std::memset (coeffs, 0, m_k);
+  std::memset (symbol, 0, m_symbolSize);
+  for (uint8_t r = 0; r < m_k; ++r)
+    {
+      if (m_present[r])
+        {
+          const uint8_t *row = &m_rows[r * m_rowSize];
+          LwsnCoding::GfMulAdd (coeffs, row, random[r], m_k);
+          LwsnCoding::GfMulAdd (symbol, row + m_k, random[r], m_symbolSize);
+        }
+    }
+}
+
+uint8_t
+LwsnRlncGeneration::GetRank (void) const
+{
+  return m_rank;
+}
+
+bool
+LwsnRlncGeneration::IsComplete (void) const
+{
+  return m_rank == m_k;
+}
+
+uint8_t
+LwsnRlncGeneration::GetK (void) const
+{
+  return m_k;
+}
+
+uint32_t
+LwsnRlncGeneration::GetSymbolSize (void) const
+{
+  return m_symbolSize;
+}
+
+const uint8_t *
+LwsnRlncGeneration::GetSymbol (uint8_t index) const
+{
+  NS_ASSERT (index < m_k);
+  if (!m_present[index])
+    {
+      return 0;
+    }
+  const uint8_t *row = &m_rows[index * m_rowSize];
+  for (uint8_t c = 0; c < m_k; ++c)
+    {
+      if (c != index && row[c] != 0)
+        {
+          return 0;
+        }
+    }
+  return row + m_k;
+}
+
+} // namespace ns3
@@ -0,0 +1,104 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_RLNC_H
+#define LWSN_RLNC_H
+
+#include <stdint.h>
+#include <vector>
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief One generation of random linear network coding over GF(2^8).
+ *
+ * A generation holds up to k linearly independent combinations of the k
+ * source symbols, kept in reduced row echelon form: row i, when present,
+ * has its pivot in column i.  Add() runs one step of Gaussian elimination
+ * per received combination, so a sink decodes incrementally and a relay
+ * can recode from whatever it has received without decoding first.
+ */
+class LwsnRlncGeneration
+{
+public:
+  /**
+   * \param k number of source symbols in the generation
+   * \param symbolSize bytes per symbol
+   */
+  LwsnRlncGeneration (uint8_t k, uint32_t symbolSize);
+
+  /**
+   * Add a coded symbol.
+   *
+   * \param coeffs k coding coefficients
+   * \param symbol symbolSize bytes of coded data
+   * \return true if the symbol increased the rank
+   */
+  bool Add (const uint8_t *coeffs, const uint8_t *symbol);
+
+  /**
+   * Add an uncoded source symbol.
+   *
+   * \param index position of the source in the generation
+   * \param symbol symbolSize bytes of data
+   * \return true if the symbol increased the rank
+   */
+  bool AddSource (uint8_t index, const uint8_t *symbol);
+
+  /**
+   * Produce a random linear combination of the received symbols.
+   *
+   * \param random k random coefficients, one per row
+   * \param coeffs receives the k resulting coding coefficients
+   * \param symbol receives symbolSize bytes of coded data
+   */
+  void Recode (const uint8_t *random, uint8_t *coeffs, uint8_t *symbol) const;
+
+  /// \return number of linearly independent symbols received
+  uint8_t GetRank (void) const;
+  /// \return true once all k source symbols can be recovered
+  bool IsComplete (void) const;
+  /// \return number of source symbols in the generation
+  uint8_t GetK (void) const;
+  /// \return bytes per symbol
+  uint32_t GetSymbolSize (void) const;
+
+  /**
+   * \param index position of the source in the generation
+   * \return the decoded source symbol, or 0 if it is not decoded yet
+   */
+  const uint8_t *GetSymbol (uint8_t index) const;
+
+private:
+  /**
+   * Reduce m_work against the stored rows and store it if innovative.
+   * \return true if the rank increased
+   */
+  bool Eliminate (void);
+
+  uint8_t m_k;                    //!< source symbols per generation
+  uint32_t m_symbolSize;          //!< bytes per symbol
+  uint32_t m_rowSize;             //!< k coefficients followed by the symbol
+  uint8_t m_rank;                 //!< rows present
+  std::vector<uint8_t> m_rows;    //!< k rows of m_rowSize bytes
+  std::vector<bool> m_present;    //!< whether row i has been filled
+  std::vector<uint8_t> m_work;    //!< row being eliminated
+};
+
+} // namespace ns3
+
+#endif /* LWSN_RLNC_H */
@@ -0,0 +1,175 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "ns3/abort.h"
+#include "ns3/boolean.h"
+#include "ns3/log.h"
+#include "ns3/node.h"
+#include "ns3/packet.h"
+#include "ns3/simulator.h"
+#include "ns3/trace-source-accessor.h"
+#include "ns3/uinteger.h"
+#include "lwsn-sensor-application.h"
+#include "lwsn-packet-pool.h"
+#include "lwsn-reading-header.h"
+#include "simple-net-device.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LwsnSensorApplication");
+
+NS_OBJECT_ENSURE_REGISTERED (LwsnSensorApplication);
+
+TypeId
+LwsnSensorApplication::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LwsnSensorApplication")
+    .SetParent<Application> ()
+    .SetGroupName ("Network")
+    .AddConstructor<LwsnSensorApplication> ()
+    .AddAttribute ("PayloadSize",
+                   "Payload bytes of a reading, sequence number included.",
+                   UintegerValue (100),
+                   MakeUintegerAccessor (&LwsnSensorApplication::m_payloadSize),
+                   MakeUintegerChecker<uint32_t> (4))
+    .AddAttribute ("Interval",
+                   "Time between two readings, the mean time with Poisson "
+                   "arrivals.  Zero means one frame of the slot schedule.",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&LwsnSensorApplication::m_interval),
+                   MakeTimeChecker ())
+    .AddAttribute ("Poisson",
+                   "Take readings at exponentially distributed gaps "
+                   "instead of every Interval.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&LwsnSensorApplication::m_poisson),
+                   MakeBooleanChecker ())
+    .AddTraceSource ("Reading",
+                     "A reading was taken: origin sid and sequence number.",
+                     MakeTraceSourceAccessor (&LwsnSensorApplication::m_readingTrace),
+                     "ns3::LwsnSensorApplication::ReadingTracedCallback")
+  ;
+  return tid;
+}
+
+LwsnSensorApplication::LwsnSensorApplication ()
+  : m_payloadSize (100),
+    m_poisson (false),
+    m_seq (0)
+{
+  NS_LOG_FUNCTION (this);
+  m_gap = CreateObject<ExponentialRandomVariable> ();
+}
+
+LwsnSensorApplication::~LwsnSensorApplication ()
+{
+  NS_LOG_FUNCTION (this);
+}
+
+uint32_t
+LwsnSensorApplication::GetSent (void) const
+{
+  return m_seq;
+}
+
+int64_t
+LwsnSensorApplication::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+  m_gap->SetStream (stream);
+  return 1;
+}
+
+void
+LwsnSensorApplication::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_device = 0;
+  m_gap = 0;
+  Application::DoDispose ();
+}
+
+void
+LwsnSensorApplication::StartApplication (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (uint32_t i = 0; i < GetNode ()->GetNDevices () && m_device == 0; ++i)
+    {
+      m_device = DynamicCast<SimpleNetDevice> (GetNode ()->GetDevice (i));
+    }
+  NS_ABORT_MSG_IF (m_device == 0, "node " << GetNode ()->GetId () << " has no SimpleNetDevice");
+  TakeReading ();
+}
+
+void
+LwsnSensorApplication::StopApplication (void)
+{
+  NS_LOG_FUNCTION (this);
+  Simulator::Cancel (m_readingEvent);
+}
+
+Time
+LwsnSensorApplication::GetNextGap (void)
+{
+  Ptr<LwsnSlotSchedule> schedule = m_device->GetSlotSchedule ();
+  Time interval = m_interval.IsZero () ? schedule->GetSlotTime (schedule->GetFrameLength ())
+                                       : m_interval;
+  if (!m_poisson)
+    {
+      return interval;
+    }
+  return Seconds (m_gap->GetValue (interval.GetSeconds (), 0));
+}
+
+void
+LwsnSensorApplication::TakeReading (void)
+{
+  NS_LOG_FUNCTION (this << m_seq);
+  uint16_t sid = m_device->GetSid ();
+  uint16_t n = m_device->GetSlotSchedule ()->GetNNodes ();
+
+  LwsnReadingHeader reading;
+  reading.SetSequence (m_seq);
+  // the packet is reused for a later reading once the device and the
+  // channel have let go of it
+  m_payload.resize (m_payloadSize - reading.GetSerializedSize ());
+  Ptr<Packet> packet = LwsnPacketPool::Get ().Acquire (m_payload.empty () ? 0 : &m_payload[0], m_payload.size ());
+  packet->AddHeader (reading);
+  LwsnFrameHeader header;
+  header.SetOsid (sid);
+  header.SetE (0);
+  header.SetR (Simulator::Now ().GetSeconds ());
+  header.SetSlot (m_device->GetSlotSchedule ()->GetSlotClock (Simulator::Now ()));
+  packet->AddHeader (header);
+
+  // one broadcast reaches both neighbors; a chain end has only one
+  if (sid != 1 && sid != n)
+    {
+      m_device->Send (packet, m_device->GetBroadcast (), 0);
+    }
+  else if (sid != 1)
+    {
+      m_device->Send (packet, m_device->GetLeftAddress (), 0);
+    }
+  else
+    {
+      m_device->Send (packet, m_device->GetRightAddress (), 0);
+    }
+  m_readingTrace (sid, m_seq);
+  ++m_seq;
+  m_readingEvent = Simulator::Schedule (GetNextGap (), &LwsnSensorApplication::TakeReading, this);
+}
+
+} // namespace ns3
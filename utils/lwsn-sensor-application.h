@@ -0,0 +1,112 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_SENSOR_APPLICATION_H
+#define LWSN_SENSOR_APPLICATION_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "ns3/application.h"
+#include "ns3/event-id.h"
+#include "ns3/nstime.h"
+#include "ns3/ptr.h"
+#include "ns3/traced-callback.h"
+#include "ns3/random-variable-stream.h"
+
+namespace ns3 {
+
+class SimpleNetDevice;
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Sensing traffic of one node of a linear WSN chain.
+ *
+ * The application takes readings on the first SimpleNetDevice of its
+ * node and sends each one towards both ends of the chain.  A reading is
+ * an LwsnHeader with the node's sid as Osid, followed by an
+ * LwsnReadingHeader with the reading's sequence number and zero
+ * padding up to PayloadSize.  Sequence numbers start at 0 and count the
+ * readings of this node.
+ *
+ * Readings are taken every Interval, or, with Poisson arrivals, at
+ * exponentially distributed gaps of mean Interval.  An Interval of zero
+ * means one frame of the device's slot schedule.
+ */
+class LwsnSensorApplication : public Application
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  LwsnSensorApplication ();
+  virtual ~LwsnSensorApplication ();
+
+  /**
+   * TracedCallback signature for readings taken.
+   *
+   * \param [in] osid sid of this node
+   * \param [in] seq sequence number of the reading
+   */
+  typedef void (* ReadingTracedCallback)(uint16_t osid, uint32_t seq);
+
+  /**
+   * \returns the number of readings taken so far
+   */
+  uint32_t GetSent (void) const;
+
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by this model.
+   *
+   * \param stream first stream index to use
+   * \return the number of stream indices assigned by this model
+   */
+  int64_t AssignStreams (int64_t stream);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  virtual void StartApplication (void);
+  virtual void StopApplication (void);
+
+  /**
+   * Take one reading, send it and schedule the next one.
+   */
+  void TakeReading (void);
+  /**
+   * \returns the time until the next reading
+   */
+  Time GetNextGap (void);
+
+  Ptr<SimpleNetDevice> m_device;  //!< device the readings are sent on
+  uint32_t m_payloadSize;         //!< payload bytes per reading
+  Time m_interval;                //!< (mean) time between readings, zero for one frame
+  bool m_poisson;                 //!< exponential rather than fixed gaps
+  Ptr<ExponentialRandomVariable> m_gap; //!< source of Poisson gaps
+  uint32_t m_seq;                 //!< sequence number of the next reading
+  std::vector<uint8_t> m_payload; //!< zeroed payload of a reading
+  EventId m_readingEvent;         //!< pending TakeReading
+  TracedCallback<uint16_t, uint32_t> m_readingTrace; //!< readings taken
+};
+
+} // namespace ns3
+
+#endif /* LWSN_SENSOR_APPLICATION_H */
@@ -0,0 +1,730 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include <algorithm>
+#include <deque>
+#include <iterator>
+
+#include "lwsn-slot-schedule.h"
+#include "ns3/log.h"
+#include "ns3/abort.h"
+#include "ns3/assert.h"
+#include "ns3/uinteger.h"
+#include "ns3/boolean.h"
+#include "ns3/nstime.h"
+#include "ns3/data-rate.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LwsnSlotSchedule");
+
+NS_OBJECT_ENSURE_REGISTERED (LwsnSlotSchedule);
+
+namespace {
+
+/**
+ * A packet waiting at a relay while the table is generated.
+ */
+struct PendingFlow
+{
+  uint16_t osid;      //!< origin sid
+  uint8_t dir;        //!< LwsnSlotSchedule::Direction
+  uint32_t ready;     //!< first frame position the relay may send it in
+};
+
+/**
+ * A relay competing for the current frame position.
+ */
+struct Candidate
+{
+  uint16_t sid;       //!< relay sid
+  bool canCode;       //!< holds a ready packet in each direction
+  uint32_t hops;      //!< most hops left to a sink among its ready packets
+  uint32_t backlog;   //!< packets waiting at the relay
+};
+
+bool
+CandidateBefore (const Candidate &a, const Candidate &b)
+{
+  if (a.canCode != b.canCode)
+    {
+      return a.canCode;
+    }
+  if (a.hops != b.hops)
+    {
+      return a.hops > b.hops;
+    }
+  if (a.backlog != b.backlog)
+    {
+      return a.backlog > b.backlog;
+    }
+  return a.sid < b.sid;
+}
+
+/**
+ * \return hops a packet at sid still has to travel in direction dir
+ */
+uint32_t
+HopsLeft (uint16_t sid, uint8_t dir, uint16_t n)
+{
+  return dir == LwsnSlotSchedule::LEFT ? sid - 1 : n - sid;
+}
+
+/**
+ * \return slots, at least one, from current to the next slot in the
+ *         sorted non-empty list
+ */
+uint16_t
+NextInList (const std::vector<uint16_t> &slots, uint16_t current, uint16_t frameLength)
+{
+  std::vector<uint16_t>::const_iterator next = std::upper_bound (slots.begin (), slots.end (), current);
+  if (next == slots.end ())
+    {
+      return slots.front () + frameLength - current;
+    }
+  return *next - current;
+}
+
+} // anonymous namespace
+
+TypeId
+LwsnSlotSchedule::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LwsnSlotSchedule")
+    .SetParent<Object> ()
+    .SetGroupName ("Network")
+    .AddConstructor<LwsnSlotSchedule> ()
+    .AddAttribute ("NNodes",
+                   "Number of sids in the chain; sid 1 and sid NNodes are the sinks.",
+                   UintegerValue (6),
+                   MakeUintegerAccessor (&LwsnSlotSchedule::m_nNodes),
+                   MakeUintegerChecker<uint16_t> (2))
+    .AddAttribute ("FrameLength",
+                   "Number of slots in a TDMA frame; 0 picks the shortest "
+                   "frame that holds the generated table.",
+                   UintegerValue (13),
+                   MakeUintegerAccessor (&LwsnSlotSchedule::m_frameLength),
+                   MakeUintegerChecker<uint16_t> ())
+    .AddAttribute ("ReuseDistance",
+                   "Minimum hop distance between two nodes sending in the same "
+                   "slot, that is the interference range plus one.",
+                   UintegerValue (3),
+                   MakeUintegerAccessor (&LwsnSlotSchedule::m_reuse),
+                   MakeUintegerChecker<uint16_t> (1))
+    .AddAttribute ("Pipelined",
+                   "Let the readings of one frame still travel while the next "
+                   "frame's are sent, so that the frame only has to avoid "
+                   "conflicts between overlapping frames.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&LwsnSlotSchedule::m_pipelined),
+                   MakeBooleanChecker ())
+    .AddAttribute ("DataRate",
+                   "Radio data rate the slot length is derived from; zero "
+                   "makes every slot last one second.",
+                   DataRateValue (DataRate ("0b/s")),
+                   MakeDataRateAccessor (&LwsnSlotSchedule::SetDataRate,
+                                         &LwsnSlotSchedule::GetDataRate),
+                   MakeDataRateChecker ())
+    .AddAttribute ("MaxFrameSize",
+                   "Largest frame in bytes, including headers, that has to fit "
+                   "in one slot.",
+                   UintegerValue (127),
+                   MakeUintegerAccessor (&LwsnSlotSchedule::SetMaxFrameSize,
+                                         &LwsnSlotSchedule::GetMaxFrameSize),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("GuardInterval",
+                   "Idle time added to the airtime of a MaxFrameSize frame to "
+                   "give the length of a slot.",
+                   TimeValue (MicroSeconds (192)),
+                   MakeTimeAccessor (&LwsnSlotSchedule::SetGuardInterval,
+                                     &LwsnSlotSchedule::GetGuardInterval),
+                   MakeTimeChecker (Time (0)))
+  ;
+  return tid;
+}
+
+LwsnSlotSchedule::LwsnSlotSchedule ()
+  : m_nNodes (6),
+    m_frameLength (13),
+    m_reuse (3),
+    m_pipelined (false),
+    m_dataRate (DataRate ("0b/s")),
+    m_maxFrameSize (127),
+    m_guardInterval (MicroSeconds (192)),
+    m_slotSteps (0),
+    m_usedSlots (0),
+    m_built (false),
+    m_firstRow (1),
+    m_lastRow (0),
+    m_routes (0),
+    m_delays (0),
+    m_tablesNNodes (0),
+    m_tablesFrameLength (0),
+    m_tablesReuse (0),
+    m_tablesPipelined (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+size_t
+LwsnSlotSchedule::Index (uint16_t sid, uint16_t osid, Direction dir) const
+{
+  return ((size_t)(sid - m_firstRow) * m_nNodes + (osid - 1)) * 2 + dir;
+}
+
+bool
+LwsnSlotSchedule::HasRow (uint16_t sid) const
+{
+  return sid >= m_firstRow && (m_lastRow == 0 || sid <= m_lastRow);
+}
+
+LwsnSlotSchedule::Direction
+LwsnSlotSchedule::GetDirection (uint16_t sid, uint16_t osid)
+{
+  return osid > sid ? LEFT : RIGHT;
+}
+
+bool
+LwsnSlotSchedule::Generate (uint32_t period, uint32_t &makespan)
+{
+  const uint16_t n = m_nNodes;
+  // 2 N entries per row; too many for a 32-bit size_t long before N
+  // reaches 65535
+  uint32_t rows = (m_lastRow == 0 ? n : m_lastRow) - m_firstRow + 1;
+  uint64_t size = (uint64_t)rows * n * 2;
+  NS_ABORT_MSG_IF (size > m_table.max_size (),
+                   "LwsnSlotSchedule: the table of " << n << " sids does not fit in memory");
+  Entry none = { 0, NONE, 0, 0, 0 };
+  m_table.assign (size, none);
+
+  // Packets waiting at each relay, one FIFO per direction.  A packet is
+  // ready one position after it arrived, so the front of a queue is
+  // always the oldest ready packet, if any.
+  std::vector<std::deque<PendingFlow> > pending ((n + 1) * 2);
+  uint32_t position = 0;
+
+  // A position is taken for a sid if a transmitter less than m_reuse hops
+  // away already has it.  With a period, positions that are equal modulo
+  // the period are the same slot of overlapping frames.
+  std::vector<uint32_t> blocked;
+  std::vector<uint8_t> reserved;
+  if (period == 0)
+    {
+      blocked.assign (n + 1, 0);
+    }
+  else
+    {
+      reserved.assign ((uint32_t)(n + 1) * period, 0);
+    }
+
+  // Originals: one broadcast per sid, reaching both neighbours.
+  uint32_t remaining = 0;
+  for (uint16_t sid = 1; sid <= n; ++sid)
+    {
+      uint32_t p = ((sid - 1) % m_reuse) + 1;
+      position = std::max (position, p);
+      if (period != 0)
+        {
+          reserved[(uint32_t)sid * period + p % period] = 1;
+        }
+      if (sid > 1 && sid - 1 > 1)
+        {
+          PendingFlow f = { sid, LEFT, p + 1 };
+          pending[(sid - 1) * 2 + LEFT].push_back (f);
+          ++remaining;
+        }
+      if (sid < n && sid + 1 < n)
+        {
+          PendingFlow f = { sid, RIGHT, p + 1 };
+          pending[(sid + 1) * 2 + RIGHT].push_back (f);
+          ++remaining;
+        }
+    }
+
+  // Relays holding packets; a relay leaves the list when it empties and
+  // rejoins when a packet reaches it.
+  std::vector<uint16_t> active;
+  std::vector<bool> isActive (n + 1, false);
+  for (uint16_t sid = 2; sid < n; ++sid)
+    {
+      active.push_back (sid);
+      isActive[sid] = true;
+    }
+
+  std::vector<Candidate> candidates;
+  while (remaining > 0)
+    {
+      ++position;
+      candidates.clear ();
+      uint32_t kept = 0;
+      for (uint32_t a = 0; a < active.size (); ++a)
+        {
+          uint16_t sid = active[a];
+          const std::deque<PendingFlow> &lq = pending[sid * 2 + LEFT];
+          const std::deque<PendingFlow> &rq = pending[sid * 2 + RIGHT];
+          if (lq.empty () && rq.empty ())
+            {
+              isActive[sid] = false;
+              continue;
+            }
+          active[kept++] = sid;
+          bool left = !lq.empty () && lq.front ().ready <= position;
+          bool right = !rq.empty () && rq.front ().ready <= position;
+          // with a period, a packet must leave within one frame of its
+          // arrival, or the relay would send it a frame early
+          if (period != 0 && ((left && position - lq.front ().ready + 1 >= period)
+                              || (right && position - rq.front ().ready + 1 >= period)))
+            {
+              return false;
+            }
+          if (left || right)
+            {
+              uint32_t hops = std::max (left ? HopsLeft (sid, LEFT, n) : 0,
+                                        right ? HopsLeft (sid, RIGHT, n) : 0);
+              Candidate c = { sid, left && right, hops, (uint32_t)(lq.size () + rq.size ()) };
+              candidates.push_back (c);
+            }
+        }
+      active.resize (kept);
+      std::sort (candidates.begin (), candidates.end (), CandidateBefore);
+
+      for (std::vector<Candidate>::const_iterator c = candidates.begin (); c != candidates.end (); ++c)
+        {
+          uint16_t lo = c->sid > m_reuse - 1 ? c->sid - (m_reuse - 1) : 1;
+          uint16_t hi = std::min<uint32_t> (n, c->sid + (m_reuse - 1));
+          if (period == 0)
+            {
+              if (blocked[c->sid] == position)
+                {
+                  continue;
+                }
+              for (uint16_t b = lo; b <= hi; ++b)
+                {
+                  blocked[b] = position;
+                }
+            }
+          else
+            {
+              uint32_t slot = position % period;
+              bool taken = false;
+              for (uint16_t b = lo; b <= hi && !taken; ++b)
+                {
+                  taken = reserved[(uint32_t)b * period + slot];
+                }
+              if (taken)
+                {
+                  continue;
+                }
+              reserved[(uint32_t)c->sid * period + slot] = 1;
+            }
+
+          // The oldest ready packet in each direction; without a partner
+          // only one direction has a ready packet, which is then forwarded.
+          PendingFlow sent[2];
+          uint32_t nSent = 0;
+          for (int d = LEFT; d <= RIGHT; ++d)
+            {
+              std::deque<PendingFlow> &q = pending[c->sid * 2 + d];
+              if (!q.empty () && q.front ().ready <= position)
+                {
+                  sent[nSent++] = q.front ();
+                  q.pop_front ();
+                }
+            }
+
+          for (uint32_t i = 0; i < nSent; ++i)
+            {
+              const PendingFlow &f = sent[i];
+              Entry e = none;
+              // without a period, Build refuses positions past 65535
+              e.slot = period == 0 ? position & 0xffff : position % period;
+              if (nSent == 2)
+                {
+                  const PendingFlow &o = sent[1 - i];
+                  e.action = CODE;
+                  e.partnerOsid = o.osid;
+                  e.partnerDir = o.dir;
+                  e.leader = f.ready < o.ready || (f.ready == o.ready && f.dir == LEFT);
+                }
+              else
+                {
+                  e.action = FORWARD;
+                }
+              if (HasRow (c->sid))
+                {
+                  m_table[Index (c->sid, f.osid, (Direction)f.dir)] = e;
+                }
+
+              uint16_t next = f.dir == LEFT ? c->sid - 1 : c->sid + 1;
+              --remaining;
+              if (next > 1 && next < n)
+                {
+                  PendingFlow g = { f.osid, f.dir, position + 1 };
+                  pending[next * 2 + f.dir].push_back (g);
+                  ++remaining;
+                  if (!isActive[next])
+                    {
+                      active.push_back (next);
+                      isActive[next] = true;
+                    }
+                }
+            }
+        }
+    }
+  makespan = position;
+  return true;
+}
+
+void
+LwsnSlotSchedule::Build (void)
+{
+  NS_LOG_FUNCTION (this << m_nNodes << m_frameLength << m_reuse << m_pipelined);
+
+  const uint16_t n = m_nNodes;
+  NS_ABORT_MSG_IF (m_lastRow > n, "LwsnSlotSchedule: row " << m_lastRow << " of " << n << " sids");
+  NS_ABORT_MSG_IF (m_routes != 0 && (m_firstRow != 1 || m_lastRow != 0),
+                   "LwsnSlotSchedule: compiled tables need every row");
+  // the compiled tables hold the values of one shape only
+  NS_ABORT_MSG_IF (m_routes != 0 && (n != m_tablesNNodes || m_frameLength != m_tablesFrameLength
+                                     || m_reuse != m_tablesReuse || m_pipelined != m_tablesPipelined),
+                   "LwsnSlotSchedule: attributes changed from the shape of the compiled tables ("
+                   << m_tablesNNodes << " sids, " << m_tablesFrameLength << " slots, reuse "
+                   << m_tablesReuse << (m_tablesPipelined ? ", pipelined)" : ")"));
+  uint32_t position = 0;
+
+  if (!m_pipelined)
+    {
+      Generate (0, position);
+    }
+  else if (m_frameLength != 0)
+    {
+      NS_ABORT_MSG_IF (!Generate (m_frameLength, position),
+                       "LwsnSlotSchedule: " << n << " sids do not fit a pipelined frame of "
+                       << m_frameLength << " slots");
+    }
+  else
+    {
+      // The unpipelined table is a valid pipelined one for its own
+      // length; search below it, assuming that a frame that fits makes
+      // longer frames fit as well.
+      Generate (0, position);
+      uint32_t lo = m_reuse;
+      uint32_t hi = position;
+      while (lo < hi)
+        {
+          uint32_t mid = lo + (hi - lo) / 2;
+          uint32_t makespan;
+          if (Generate (mid, makespan))
+            {
+              hi = mid;
+            }
+          else
+            {
+              lo = mid + 1;
+            }
+        }
+      if (hi < position)
+        {
+          NS_ASSERT (hi <= 0xffff);
+          m_frameLength = hi;
+          Generate (hi, position);
+        }
+      else
+        {
+          // fall back to the unpipelined table found first
+          Generate (0, position);
+        }
+    }
+
+  // FrameLength 0 asks for the shortest frame that holds the table.
+  if (m_frameLength == 0)
+    {
+      NS_ABORT_MSG_IF (position > 0xffff, "LwsnSlotSchedule: " << n << " sids need more than 65535 slots");
+      m_frameLength = position;
+    }
+  NS_ABORT_MSG_IF (!m_pipelined && position > m_frameLength,
+                   "LwsnSlotSchedule: " << n << " sids need " << position
+                   << " slots but the frame has only " << m_frameLength);
+  for (size_t i = 0; i < m_table.size (); ++i)
+    {
+      m_table[i].slot %= m_frameLength;
+    }
+
+  m_txSlots.assign (n + 1, std::vector<uint16_t> ());
+  for (uint16_t sid = 1; sid <= n; ++sid)
+    {
+      if (!HasRow (sid))
+        {
+          continue;
+        }
+      std::vector<uint16_t> &slots = m_txSlots[sid];
+      slots.push_back ((((sid - 1) % m_reuse) + 1) % m_frameLength);
+      size_t row = Index (sid, 1, LEFT);
+      for (size_t i = row; i < row + 2 * (size_t)n; ++i)
+        {
+          if (m_table[i].action != NONE)
+            {
+              slots.push_back (m_table[i].slot);
+            }
+        }
+      std::sort (slots.begin (), slots.end ());
+      slots.erase (std::unique (slots.begin (), slots.end ()), slots.end ());
+    }
+
+  // a node listens whenever a neighbor transmits
+  m_rxSlots.assign (n + 1, std::vector<uint16_t> ());
+  for (uint16_t sid = 1; sid <= n; ++sid)
+    {
+      const std::vector<uint16_t> &left = m_txSlots[sid == 1 ? 0 : sid - 1];
+      const std::vector<uint16_t> &right = m_txSlots[sid == n ? 0 : sid + 1];
+      std::set_union (left.begin (), left.end (), right.begin (), right.end (),
+                      std::back_inserter (m_rxSlots[sid]));
+    }
+
+  m_usedSlots = position;
+  m_built = true;
+  NS_LOG_LOGIC ("chain of " << n << " sids needs " << m_usedSlots << " slots, frame of "
+                << m_frameLength);
+}
+
+uint16_t
+LwsnSlotSchedule::GetUsedSlots (void)
+{
+  if (!m_built)
+    {
+      Build ();
+    }
+  return m_usedSlots;
+}
+
+uint16_t
+LwsnSlotSchedule::GetNNodes (void) const
+{
+  return m_nNodes;
+}
+
+uint16_t
+LwsnSlotSchedule::GetFrameLength (void)
+{
+  if (m_frameLength == 0)
+    {
+      Build ();
+    }
+  return m_frameLength;
+}
+
+uint16_t
+LwsnSlotSchedule::GetOriginalSlot (uint16_t sid)
+{
+  NS_ASSERT (sid >= 1 && sid <= m_nNodes);
+  return (((sid - 1) % m_reuse) + 1) % GetFrameLength ();
+}
+
+const LwsnSlotSchedule::Entry &
+LwsnSlotSchedule::Lookup (uint16_t sid, uint16_t osid, Direction dir)
+{
+  if (!m_built)
+    {
+      Build ();
+    }
+  NS_ASSERT (HasRow (sid) && sid <= m_nNodes && osid >= 1 && osid <= m_nNodes);
+  return m_table[Index (sid, osid, dir)];
+}
+
+const LwsnSlotSchedule::Entry &
+LwsnSlotSchedule::GetRoute (uint16_t sid, uint16_t osid)
+{
+  if (m_routes != 0)
+    {
+      NS_ASSERT (sid >= 1 && sid <= m_tablesNNodes && osid >= 1 && osid <= m_tablesNNodes);
+      return m_routes[(uint32_t)sid * (m_tablesNNodes + 1) + osid];
+    }
+  return Lookup (sid, osid, GetDirection (sid, osid));
+}
+
+uint16_t
+LwsnSlotSchedule::GetDelay (uint16_t sid, uint16_t osid, uint64_t now)
+{
+  if (m_delays != 0)
+    {
+      NS_ASSERT (sid >= 1 && sid <= m_tablesNNodes && osid >= 1 && osid <= m_tablesNNodes);
+      return m_delays[((uint32_t)sid * (m_tablesNNodes + 1) + osid) * m_tablesFrameLength
+                      + now % m_tablesFrameLength];
+    }
+  return GetWait (osid == sid ? GetOriginalSlot (sid) : GetRoute (sid, osid).slot, now);
+}
+
+void
+LwsnSlotSchedule::SetRows (uint16_t first, uint16_t last)
+{
+  NS_LOG_FUNCTION (this << first << last);
+  NS_ASSERT (first >= 1 && first <= last && !m_built);
+  m_firstRow = first;
+  m_lastRow = last;
+}
+
+void
+LwsnSlotSchedule::SetTables (const Entry *routes, const uint16_t *delays, uint16_t nNodes,
+                             uint16_t frameLength, uint16_t reuse, bool pipelined)
+{
+  NS_LOG_FUNCTION (this << routes << delays << nNodes << frameLength << reuse << pipelined);
+  NS_ASSERT (routes != 0 && delays != 0 && frameLength != 0);
+  m_routes = routes;
+  m_delays = delays;
+  m_tablesNNodes = nNodes;
+  m_tablesFrameLength = frameLength;
+  m_tablesReuse = reuse;
+  m_tablesPipelined = pipelined;
+}
+
+uint16_t
+LwsnSlotSchedule::GetNextTxWait (uint16_t sid, uint64_t now)
+{
+  if (!m_built)
+    {
+      Build ();
+    }
+  NS_ASSERT (HasRow (sid) && sid <= m_nNodes);
+  return NextInList (m_txSlots[sid], now % m_frameLength, m_frameLength);
+}
+
+uint16_t
+LwsnSlotSchedule::GetNextActiveWait (uint16_t sid, uint64_t now)
+{
+  if (!m_built)
+    {
+      Build ();
+    }
+  NS_ASSERT (HasRow (sid) && sid <= m_nNodes);
+  uint16_t current = now % m_frameLength;
+  uint16_t wait = NextInList (m_txSlots[sid], current, m_frameLength);
+  if (!m_rxSlots[sid].empty ())
+    {
+      wait = std::min (wait, NextInList (m_rxSlots[sid], current, m_frameLength));
+    }
+  return wait;
+}
+
+bool
+LwsnSlotSchedule::IsTxSlot (uint16_t sid, uint16_t slot)
+{
+  if (!m_built)
+    {
+      Build ();
+    }
+  NS_ASSERT (HasRow (sid) && sid <= m_nNodes);
+  return std::binary_search (m_txSlots[sid].begin (), m_txSlots[sid].end (), slot);
+}
+
+bool
+LwsnSlotSchedule::IsRxSlot (uint16_t sid, uint16_t slot)
+{
+  if (!m_built)
+    {
+      Build ();
+    }
+  NS_ASSERT (sid >= 1 && sid <= m_nNodes);
+  return std::binary_search (m_rxSlots[sid].begin (), m_rxSlots[sid].end (), slot);
+}
+
+Time
+LwsnSlotSchedule::GetSlotDuration (void)
+{
+  if (m_slotSteps == 0)
+    {
+      Time slot = Seconds (1);
+      if (m_dataRate > DataRate (0))
+        {
+          slot = m_dataRate.CalculateBytesTxTime (m_maxFrameSize) + m_guardInterval;
+        }
+      m_slotSteps = slot.GetTimeStep ();
+      NS_ABORT_MSG_IF (m_slotSteps <= 0, "slot length below the time resolution");
+      NS_LOG_LOGIC ("slot lasts " << slot);
+    }
+  return TimeStep (m_slotSteps);
+}
+
+void
+LwsnSlotSchedule::SetDataRate (DataRate rate)
+{
+  NS_LOG_FUNCTION (this << rate);
+  m_dataRate = rate;
+  m_slotSteps = 0;
+}
+
+DataRate
+LwsnSlotSchedule::GetDataRate (void) const
+{
+  return m_dataRate;
+}
+
+void
+LwsnSlotSchedule::SetMaxFrameSize (uint32_t size)
+{
+  NS_LOG_FUNCTION (this << size);
+  m_maxFrameSize = size;
+  m_slotSteps = 0;
+}
+
+uint32_t
+LwsnSlotSchedule::GetMaxFrameSize (void) const
+{
+  return m_maxFrameSize;
+}
+
+void
+LwsnSlotSchedule::SetGuardInterval (Time guard)
+{
+  NS_LOG_FUNCTION (this << guard);
+  m_guardInterval = guard;
+  m_slotSteps = 0;
+}
+
+Time
+LwsnSlotSchedule::GetGuardInterval (void) const
+{
+  return m_guardInterval;
+}
+
+uint64_t
+LwsnSlotSchedule::GetSlotClock (Time time)
+{
+  // integer division, so a slot boundary always maps to its own slot
+  GetSlotDuration ();
+  return time.GetTimeStep () / m_slotSteps;
+}
+
+Time
+LwsnSlotSchedule::GetSlotTime (uint64_t slots)
+{
+  GetSlotDuration ();
+  return TimeStep (slots * m_slotSteps);
+}
+
+uint64_t
+LwsnSlotSchedule::GetFrame (uint64_t now)
+{
+  // slot 0 closes the frame that slot 1 opened
+  return now == 0 ? 0 : (now - 1) / GetFrameLength ();
+}
+
+uint16_t
+LwsnSlotSchedule::GetWait (uint16_t slot, uint64_t now)
+{
+  uint16_t frameLength = GetFrameLength ();
+  return (slot + frameLength - (uint16_t)(now % frameLength)) % frameLength;
+}
+
+} // namespace ns3
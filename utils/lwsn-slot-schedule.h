@@ -0,0 +1,312 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_SLOT_SCHEDULE_H
+#define LWSN_SLOT_SCHEDULE_H
+
+#include <stdint.h>
+#include <vector>
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/data-rate.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief TDMA slot table for a linear WSN chain with pairwise network coding.
+ *
+ * Every sid in 1..N originates one reading per frame which travels to
+ * both ends of the chain (sid 1 and sid N).  The table is generated by
+ * list scheduling over the frame: originals are sent in the first
+ * ReuseDistance slots, then in every following slot each relay that holds
+ * packets transmits, provided no other transmitter within ReuseDistance
+ * hops was already given that slot.  A relay holding a left-bound and a
+ * right-bound packet codes them into a single transmission.
+ *
+ * Slots are numbered 0..FrameLength-1; a frame starts with slot 1 and
+ * ends with slot 0, which matches the "clock % FrameLength" arithmetic of
+ * the device.  The slot clock counts whole slots since time zero.  A slot
+ * lasts the airtime of a MaxFrameSize frame at DataRate plus the
+ * GuardInterval, which is a few milliseconds on a 250 kb/s radio; a
+ * DataRate of zero keeps the one-second slots of the original model.
+ * The default attributes (6 nodes, 13 slots, reuse distance 3) generate
+ * the table the 13-slot scheme was designed around.
+ *
+ * By default every reading reaches the sinks within its own frame.  With
+ * Pipelined set, the readings of one frame may still travel while the
+ * next frame's are sent.  The list scheduler then treats positions that
+ * are equal modulo the frame length as one slot, and a relay has to send
+ * every packet within one frame of receiving it.  FrameLength 0 picks the
+ * shortest such frame the scheduler finds.
+ *
+ * The table holds an entry per relay, origin and direction, 16 N^2 bytes
+ * in all (1.6 GB for 10^4 sids), and takes quadratic time to generate;
+ * it is built on first use.  Flows wait at relays at irregular points,
+ * so the rows do not compress.  With the default reuse distance an
+ * unpipelined frame needs about 7.4 slots per sid, which limits such
+ * chains to some 8800 sids.  A partition of a parallel run only needs
+ * the rows of its own relays; SetRows keeps just those.
+ *
+ * GetRoute and GetDelay are what the devices call per packet.  They look
+ * the table up and count the slots to the entry's next occurrence; a
+ * schedule made by LwsnFixedSlotSchedule answers both from one element
+ * of a constant array compiled in for its shape, without building the
+ * table first.
+ */
+class LwsnSlotSchedule : public Object
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  LwsnSlotSchedule ();
+
+  /// Direction a flow travels along the chain.
+  enum Direction
+  {
+    LEFT = 0,   //!< towards sid 1
+    RIGHT = 1   //!< towards sid N
+  };
+
+  /// What a relay does with a flow in its slot.
+  enum Action
+  {
+    NONE = 0,   //!< the relay does not carry this flow
+    FORWARD,    //!< sent alone
+    CODE        //!< XORed with the partner flow in a single transmission
+  };
+
+  /**
+   * \brief Slot table entry for one (relay sid, origin sid, direction).
+   */
+  struct Entry
+  {
+    uint16_t slot;        //!< slot index inside the frame
+    uint8_t action;       //!< one of Action
+    uint8_t leader;       //!< 1 if this flow reaches the relay before its partner
+    uint16_t partnerOsid; //!< origin of the partner flow when coded
+    uint8_t partnerDir;   //!< direction of the partner flow when coded
+  };
+
+  /**
+   * Generate the slot table for the configured chain length, frame
+   * length and reuse distance.  Aborts if the transmissions do not fit
+   * in the frame.
+   */
+  void Build (void);
+
+  /**
+   * \return the number of slots from the first original to the last
+   *         relay transmission of one frame's readings; more than the
+   *         frame length if the schedule is pipelined
+   */
+  uint16_t GetUsedSlots (void);
+
+  /// \return the number of nodes in the chain
+  uint16_t GetNNodes (void) const;
+  /// \return the number of slots per frame
+  uint16_t GetFrameLength (void);
+
+  /**
+   * \param sid sid of the node
+   * \return the slot in which the node sends its own reading
+   */
+  uint16_t GetOriginalSlot (uint16_t sid);
+
+  /**
+   * \param sid sid of the relay
+   * \param osid origin sid of the flow
+   * \param dir direction the flow travels
+   * \return the table entry; its action is NONE if the relay does not
+   *         carry this flow
+   */
+  const Entry &Lookup (uint16_t sid, uint16_t osid, Direction dir);
+
+  /**
+   * \param sid sid of the relay
+   * \param osid origin sid of a flow through it
+   * \return the table entry of the flow in the direction it leaves sid
+   */
+  const Entry &GetRoute (uint16_t sid, uint16_t osid);
+
+  /**
+   * \param sid sid of the node
+   * \param osid origin sid of a flow through it, or sid itself for the
+   *        node's own readings
+   * \param now current slot clock
+   * \return the number of slots from now until the node sends that flow
+   */
+  uint16_t GetDelay (uint16_t sid, uint16_t osid, uint64_t now);
+
+  /**
+   * Serve GetRoute and GetDelay from constant tables generated for one
+   * shape, as LwsnFixedSlotSchedule does.  Build aborts if the attributes
+   * no longer give that shape.
+   *
+   * \param routes (nNodes + 1)^2 entries, indexed sid * (nNodes + 1) + osid
+   * \param delays frameLength delays for each of those, by now % frameLength
+   * \param nNodes NNodes the tables are sized for
+   * \param frameLength FrameLength the tables are sized for
+   * \param reuse ReuseDistance of the schedules sharing the tables
+   * \param pipelined Pipelined of the schedules sharing the tables
+   */
+  void SetTables (const Entry *routes, const uint16_t *delays, uint16_t nNodes,
+                  uint16_t frameLength, uint16_t reuse, bool pipelined);
+
+  /**
+   * Keep only the table rows of the relays first..last, as one partition
+   * of a parallel run needs; the scheduler still runs over the whole
+   * chain.  The other sids must not be looked up.  Call before the table
+   * is built; it does not combine with SetTables.
+   *
+   * \param first sid of the first row to keep
+   * \param last sid of the last row to keep
+   */
+  void SetRows (uint16_t first, uint16_t last);
+
+  /// \return the length of one slot
+  Time GetSlotDuration (void);
+
+  /// \param rate radio data rate the slot length is derived from
+  void SetDataRate (DataRate rate);
+  /// \return the radio data rate, zero for one-second slots
+  DataRate GetDataRate (void) const;
+  /// \param size largest frame in bytes a slot has to hold
+  void SetMaxFrameSize (uint32_t size);
+  /// \return the largest frame in bytes a slot holds
+  uint32_t GetMaxFrameSize (void) const;
+  /// \param guard idle time at the end of every slot
+  void SetGuardInterval (Time guard);
+  /// \return the idle time at the end of every slot
+  Time GetGuardInterval (void) const;
+
+  /**
+   * \param time simulation time
+   * \return the slot clock at that time, the number of whole slots since
+   *         time zero
+   */
+  uint64_t GetSlotClock (Time time);
+
+  /**
+   * \param slots number of slots
+   * \return the time the slots last, which is also the time at which the
+   *         slot clock reaches slots
+   */
+  Time GetSlotTime (uint64_t slots);
+
+  /**
+   * \param slot target slot index
+   * \param now current slot clock
+   * \return the number of slots from now until the next occurrence of slot
+   */
+  uint16_t GetWait (uint16_t slot, uint64_t now);
+
+  /**
+   * \param now current slot clock
+   * \return the index of the frame the slot belongs to
+   */
+  uint64_t GetFrame (uint64_t now);
+
+  /**
+   * \param sid sid of the node
+   * \param now current slot clock
+   * \return the number of slots, at least one, until the next slot in
+   *         which the node transmits anything
+   */
+  uint16_t GetNextTxWait (uint16_t sid, uint64_t now);
+
+  /**
+   * \param sid sid of the node
+   * \param now current slot clock
+   * \return the number of slots, at least one, until the next slot in
+   *         which the node transmits or one of its neighbors does
+   */
+  uint16_t GetNextActiveWait (uint16_t sid, uint64_t now);
+
+  /**
+   * \param sid sid of the node
+   * \param slot slot index inside the frame
+   * \return true if the node transmits anything in the slot
+   */
+  bool IsTxSlot (uint16_t sid, uint16_t slot);
+
+  /**
+   * \param sid sid of the node
+   * \param slot slot index inside the frame
+   * \return true if a neighbor of the node transmits in the slot
+   */
+  bool IsRxSlot (uint16_t sid, uint16_t slot);
+
+  /**
+   * \param sid sid of the relay
+   * \param osid origin sid of the flow
+   * \return the direction in which the flow from osid leaves sid
+   */
+  static Direction GetDirection (uint16_t sid, uint16_t osid);
+
+private:
+  /**
+   * \return the index of (sid, osid, dir) in m_table
+   */
+  size_t Index (uint16_t sid, uint16_t osid, Direction dir) const;
+
+  /**
+   * \return true if the table keeps the row of sid
+   */
+  bool HasRow (uint16_t sid) const;
+
+  /**
+   * Run the list scheduler over one frame's readings and fill m_table.
+   * The slot of an entry holds its position modulo the period, or
+   * modulo 65536 without one.
+   *
+   * \param period frame length positions repeat with, 0 for none
+   * \param makespan set to the last position used
+   * \return false if, with a period, some packet would wait a whole
+   *         period at a relay
+   */
+  bool Generate (uint32_t period, uint32_t &makespan);
+
+  uint16_t m_nNodes;        //!< number of sids in the chain
+  uint16_t m_frameLength;   //!< slots per frame
+  uint16_t m_reuse;         //!< hops between two transmitters sharing a slot
+  bool m_pipelined;         //!< frames may overlap
+  DataRate m_dataRate;      //!< radio rate the slot length is derived from
+  uint32_t m_maxFrameSize;  //!< largest frame a slot has to hold, in bytes
+  Time m_guardInterval;     //!< idle time at the end of every slot
+  int64_t m_slotSteps;      //!< slot length in time steps, 0 until computed
+  uint16_t m_usedSlots;     //!< slots occupied by the generated table
+  bool m_built;             //!< true once m_table is valid
+  uint16_t m_firstRow;      //!< sid of the first row kept
+  uint16_t m_lastRow;       //!< sid of the last row kept, 0 for NNodes
+  std::vector<Entry> m_table; //!< N x 2 entries per kept row, row per relay sid
+  std::vector<std::vector<uint16_t> > m_txSlots; //!< sorted slots each sid transmits in
+  std::vector<std::vector<uint16_t> > m_rxSlots; //!< sorted slots each sid listens in
+  const Entry *m_routes;    //!< route per (sid, osid), 0 to compute them
+  const uint16_t *m_delays; //!< delay per (sid, osid, slot), 0 to compute them
+  uint16_t m_tablesNNodes;  //!< NNodes m_routes and m_delays are sized for
+  uint16_t m_tablesFrameLength; //!< FrameLength m_delays is sized for
+  uint16_t m_tablesReuse;   //!< ReuseDistance the tables hold values of
+  bool m_tablesPipelined;   //!< Pipelined the tables hold values of
+};
+
+} // namespace ns3
+
+#endif /* LWSN_SLOT_SCHEDULE_H */
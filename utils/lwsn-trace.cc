@@ -0,0 +1,167 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include <cstdio>
+#include <cstring>
+
+#include "lwsn-trace.h"
+
+namespace ns3 {
+
+namespace LwsnTrace {
+
+namespace {
+
+const char g_magic[4] = { 'L', 'W', 'T', 'R' };
+const uint32_t g_version = 1;
+
+/**
+ * File header written in front of the records.
+ */
+struct FileHeader
+{
+  char magic[4];        //!< "LWTR"
+  uint32_t version;     //!< format version
+  uint32_t recordSize;  //!< sizeof (Record)
+  uint32_t reserved;    //!< zero
+  uint64_t total;       //!< records added by the writer
+  uint64_t count;       //!< records following the header
+};
+
+/**
+ * The ring behind Add.
+ */
+struct Ring
+{
+  Ring ()
+    : head (0)
+  {
+    Resize (1 << 16);
+  }
+  void Resize (uint32_t records)
+  {
+    uint32_t capacity = 1;
+    while (capacity < records)
+      {
+        capacity <<= 1;
+      }
+    std::vector<Record> (capacity).swap (slots);
+    mask = capacity - 1;
+    head = 0;
+  }
+  std::vector<Record> slots; //!< preallocated records
+  uint64_t mask;             //!< capacity - 1
+  uint64_t head;             //!< records added so far
+};
+
+Ring &
+GetRing (void)
+{
+  static Ring ring;
+  return ring;
+}
+
+} // anonymous namespace
+
+void
+SetCapacity (uint32_t records)
+{
+  GetRing ().Resize (records);
+}
+
+void
+Add (int64_t time, uint8_t event, uint16_t sid, uint16_t osid, uint16_t osid2, uint32_t size)
+{
+  Ring &ring = GetRing ();
+  Record &record = ring.slots[ring.head & ring.mask];
+  record.time = time;
+  record.sid = sid;
+  record.osid = osid;
+  record.osid2 = osid2;
+  record.event = event;
+  record.reserved = 0;
+  record.size = size;
+  record.pad = 0;
+  ++ring.head;
+}
+
+uint64_t
+GetNRecords (void)
+{
+  return GetRing ().head;
+}
+
+bool
+Write (const std::string &filename)
+{
+  const Ring &ring = GetRing ();
+  FILE *file = std::fopen (filename.c_str (), "wb");
+  if (file == 0)
+    {
+      return false;
+    }
+  uint64_t capacity = ring.mask + 1;
+  uint64_t count = ring.head < capacity ? ring.head : capacity;
+  FileHeader header;
+  std::memset (&header, 0, sizeof (header));
+  std::memcpy (header.magic, g_magic, sizeof (g_magic));
+  header.version = g_version;
+  header.recordSize = sizeof (Record);
+  header.total = ring.head;
+  header.count = count;
+  bool ok = std::fwrite (&header, sizeof (header), 1, file) == 1;
+
+  // oldest first: the part after the write position, then the part before
+  uint64_t start = (ring.head - count) & ring.mask;
+  uint64_t first = count < capacity - start ? count : capacity - start;
+  ok = ok && std::fwrite (&ring.slots[start], sizeof (Record), first, file) == first;
+  ok = ok && std::fwrite (&ring.slots[0], sizeof (Record), count - first, file) == count - first;
+  return std::fclose (file) == 0 && ok;
+}
+
+bool
+Read (const std::string &filename, std::vector<Record> &records, uint64_t &total)
+{
+  FILE *file = std::fopen (filename.c_str (), "rb");
+  if (file == 0)
+    {
+      return false;
+    }
+  FileHeader header;
+  bool ok = std::fread (&header, sizeof (header), 1, file) == 1
+    && std::memcmp (header.magic, g_magic, sizeof (g_magic)) == 0
+    && header.version == g_version
+    && header.recordSize == sizeof (Record);
+  if (ok)
+    {
+      records.resize (header.count);
+      ok = header.count == 0
+        || std::fread (&records[0], sizeof (Record), header.count, file) == header.count;
+      total = header.total;
+    }
+  std::fclose (file);
+  return ok;
+}
+
+const char *
+GetEventName (uint8_t event)
+{
+  static const char *names[EVENTS] = { "rx", "tx", "encode", "decode", "forward", "drop", "deliver" };
+  return event < EVENTS ? names[event] : "unknown";
+}
+
+} // namespace LwsnTrace
+
+} // namespace ns3
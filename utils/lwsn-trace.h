@@ -0,0 +1,141 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_TRACE_H
+#define LWSN_TRACE_H
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+/**
+ * \ingroup netdevice
+ *
+ * Record a typed event of the linear WSN devices in the binary trace
+ * ring.  Defined only when the module is built with NS3_LWSN_TRACE;
+ * otherwise the macro and the evaluation of its arguments compile out.
+ *
+ * \param event one of ns3::LwsnTrace::Event
+ * \param sid sid of the recording device
+ * \param osid origin sid of the packet, 0 if none
+ * \param osid2 second origin sid of a coded packet, 0 if none
+ * \param size packet size in bytes
+ */
+#ifdef NS3_LWSN_TRACE
+#define LWSN_TRACE(event, sid, osid, osid2, size)                       \
+  ns3::LwsnTrace::Add (ns3::Simulator::Now ().GetTimeStep (), event, sid, osid, osid2, size)
+#else
+#define LWSN_TRACE(event, sid, osid, osid2, size) \
+  do { } while (false)
+#endif
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Fixed-size binary trace of the per-packet events of the linear
+ * WSN devices.
+ *
+ * Records go into a preallocated ring that keeps the most recent
+ * records; recording never allocates or formats text.  Write dumps the
+ * ring to a file, oldest record first, and Read loads such a file back
+ * for offline decoding (see scratch/lwsn-trace-decode.cc).  Files use
+ * the byte order of the host that wrote them.
+ */
+namespace LwsnTrace {
+
+/// Typed events.
+enum Event
+{
+  RX = 0,   //!< a packet addressed to the device arrived
+  TX,       //!< the device put a packet on the channel
+  ENCODE,   //!< two flows were coded into one packet
+  DECODE,   //!< a flow was recovered from a coded packet
+  FORWARD,  //!< a flow was forwarded uncoded
+  DROP,     //!< a packet was lost or useless at the device
+  DELIVER,  //!< a sink received a flow
+  EVENTS    //!< number of event types
+};
+
+/// One trace record, 24 bytes on disk.
+struct Record
+{
+  int64_t time;     //!< simulation time in time steps
+  uint16_t sid;     //!< recording device
+  uint16_t osid;    //!< origin sid, 0 if none
+  uint16_t osid2;   //!< second origin sid, 0 if none
+  uint8_t event;    //!< one of Event
+  uint8_t reserved; //!< zero
+  uint32_t size;    //!< packet size in bytes
+  uint32_t pad;     //!< zero
+};
+
+/**
+ * Drop all records and preallocate room for the given number, rounded
+ * up to a power of two.  The default ring holds 65536 records.
+ *
+ * \param records ring capacity in records
+ */
+void SetCapacity (uint32_t records);
+
+/**
+ * Store one record, overwriting the oldest one if the ring is full.
+ * Use LWSN_TRACE rather than calling this directly.
+ *
+ * \param time simulation time in time steps
+ * \param event one of Event
+ * \param sid recording device
+ * \param osid origin sid
+ * \param osid2 second origin sid
+ * \param size packet size in bytes
+ */
+void Add (int64_t time, uint8_t event, uint16_t sid, uint16_t osid, uint16_t osid2, uint32_t size);
+
+/**
+ * \return the number of records added since the last SetCapacity,
+ *         including overwritten ones
+ */
+uint64_t GetNRecords (void);
+
+/**
+ * Write the records still in the ring to a file, oldest first.
+ *
+ * \param filename output file
+ * \return false if the file could not be written
+ */
+bool Write (const std::string &filename);
+
+/**
+ * Load a file written by Write.
+ *
+ * \param filename input file
+ * \param records filled with the records, oldest first
+ * \param total set to the number of records the writer had added
+ * \return false if the file is missing or not a trace
+ */
+bool Read (const std::string &filename, std::vector<Record> &records, uint64_t &total);
+
+/**
+ * \param event one of Event
+ * \return a short lower-case name of the event
+ */
+const char *GetEventName (uint8_t event);
+
+} // namespace LwsnTrace
+
+} // namespace ns3
+
+#endif /* LWSN_TRACE_H */
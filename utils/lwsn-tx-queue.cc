@@ -0,0 +1,218 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#include "lwsn-tx-queue.h"
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/trace-source-accessor.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("LwsnTxQueue");
+
+NS_OBJECT_ENSURE_REGISTERED (LwsnTxQueue);
+
+TypeId
+LwsnTxQueue::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::LwsnTxQueue")
+    .SetParent<Object> ()
+    .SetGroupName ("Network")
+    .AddConstructor<LwsnTxQueue> ()
+    .AddAttribute ("MaxAckPackets",
+                   "Explicit acknowledgements the queue holds before it drops "
+                   "new ones.",
+                   UintegerValue (100),
+                   MakeUintegerAccessor (&LwsnTxQueue::m_maxAck),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("MaxCodedPackets",
+                   "Coded frames the queue holds before it drops new ones.",
+                   UintegerValue (100),
+                   MakeUintegerAccessor (&LwsnTxQueue::m_maxCoded),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("MaxForwardPackets",
+                   "Relayed frames the queue holds before it drops new ones.",
+                   UintegerValue (100),
+                   MakeUintegerAccessor (&LwsnTxQueue::m_maxForward),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("MaxOriginalPackets",
+                   "Frames with the node's own readings the queue holds before "
+                   "it drops new ones.",
+                   UintegerValue (100),
+                   MakeUintegerAccessor (&LwsnTxQueue::m_maxOriginal),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddTraceSource ("AckPackets",
+                     "Number of explicit acknowledgements in the queue.",
+                     MakeTraceSourceAccessor (&LwsnTxQueue::m_nAck),
+                     "ns3::TracedValueCallback::Uint32")
+    .AddTraceSource ("CodedPackets",
+                     "Number of coded frames in the queue.",
+                     MakeTraceSourceAccessor (&LwsnTxQueue::m_nCoded),
+                     "ns3::TracedValueCallback::Uint32")
+    .AddTraceSource ("ForwardPackets",
+                     "Number of relayed frames in the queue.",
+                     MakeTraceSourceAccessor (&LwsnTxQueue::m_nForward),
+                     "ns3::TracedValueCallback::Uint32")
+    .AddTraceSource ("OriginalPackets",
+                     "Number of frames with the node's own readings in the queue.",
+                     MakeTraceSourceAccessor (&LwsnTxQueue::m_nOriginal),
+                     "ns3::TracedValueCallback::Uint32")
+    .AddTraceSource ("Drop",
+                     "A packet was dropped because its class was full: the "
+                     "class and the packet.",
+                     MakeTraceSourceAccessor (&LwsnTxQueue::m_dropTrace),
+                     "ns3::LwsnTxQueue::DropTracedCallback")
+  ;
+  return tid;
+}
+
+LwsnTxQueue::LwsnTxQueue ()
+  : m_maxAck (100),
+    m_maxCoded (100),
+    m_maxForward (100),
+    m_maxOriginal (100),
+    m_nAck (0),
+    m_nCoded (0),
+    m_nForward (0),
+    m_nOriginal (0)
+{
+  NS_LOG_FUNCTION (this);
+  for (uint32_t c = 0; c < CLASSES; ++c)
+    {
+      m_drops[c] = 0;
+    }
+}
+
+uint32_t
+LwsnTxQueue::GetLimit (Class cls) const
+{
+  switch (cls)
+    {
+    case ACK:
+      return m_maxAck;
+    case CODED:
+      return m_maxCoded;
+    case FORWARD:
+      return m_maxForward;
+    default:
+      return m_maxOriginal;
+    }
+}
+
+TracedValue<uint32_t> &
+LwsnTxQueue::GetOccupancy (Class cls)
+{
+  switch (cls)
+    {
+    case ACK:
+      return m_nAck;
+    case CODED:
+      return m_nCoded;
+    case FORWARD:
+      return m_nForward;
+    default:
+      return m_nOriginal;
+    }
+}
+
+bool
+LwsnTxQueue::Enqueue (Class cls, Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << cls << packet);
+  if (m_packets[cls].size () >= GetLimit (cls))
+    {
+      NS_LOG_LOGIC ("class " << cls << " full, dropping " << packet);
+      ++m_drops[cls];
+      m_dropTrace (cls, packet);
+      return false;
+    }
+  m_packets[cls].push_back (packet);
+  GetOccupancy (cls) = m_packets[cls].size ();
+  return true;
+}
+
+Ptr<Packet>
+LwsnTxQueue::Dequeue (Class worst, Class &cls)
+{
+  for (uint32_t c = 0; c <= worst && c < CLASSES; ++c)
+    {
+      if (!m_packets[c].empty ())
+        {
+          cls = static_cast<Class> (c);
+          Ptr<Packet> packet = m_packets[c].front ();
+          m_packets[c].pop_front ();
+          GetOccupancy (cls) = m_packets[c].size ();
+          return packet;
+        }
+    }
+  return 0;
+}
+
+Ptr<const Packet>
+LwsnTxQueue::Peek (Class worst) const
+{
+  for (uint32_t c = 0; c <= worst && c < CLASSES; ++c)
+    {
+      if (!m_packets[c].empty ())
+        {
+          return m_packets[c].front ();
+        }
+    }
+  return 0;
+}
+
+uint32_t
+LwsnTxQueue::GetNPackets (void) const
+{
+  uint32_t n = 0;
+  for (uint32_t c = 0; c < CLASSES; ++c)
+    {
+      n += m_packets[c].size ();
+    }
+  return n;
+}
+
+uint32_t
+LwsnTxQueue::GetNPackets (Class cls) const
+{
+  return m_packets[cls].size ();
+}
+
+uint64_t
+LwsnTxQueue::GetDrops (Class cls) const
+{
+  return m_drops[cls];
+}
+
+void
+LwsnTxQueue::Clear (void)
+{
+  NS_LOG_FUNCTION (this);
+  for (uint32_t c = 0; c < CLASSES; ++c)
+    {
+      m_packets[c].clear ();
+      GetOccupancy (static_cast<Class> (c)) = 0;
+    }
+}
+
+void
+LwsnTxQueue::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  Clear ();
+  Object::DoDispose ();
+}
+
+} // namespace ns3
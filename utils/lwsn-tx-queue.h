@@ -0,0 +1,144 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ */
+#ifndef LWSN_TX_QUEUE_H
+#define LWSN_TX_QUEUE_H
+
+#include <stdint.h>
+#include <deque>
+
+#include "ns3/object.h"
+#include "ns3/packet.h"
+#include "ns3/traced-value.h"
+#include "ns3/traced-callback.h"
+
+namespace ns3 {
+
+/**
+ * \ingroup netdevice
+ *
+ * \brief Transmit queue of a linear WSN device with one FIFO per
+ * traffic class.
+ *
+ * Explicit acknowledgements are a few bytes and hold up a neighbor's
+ * ARQ until they arrive, so they come first.  Coded frames serve two
+ * flows at once and come next, then frames relayed for other nodes,
+ * then the node's own readings.  Each class
+ * has its own limit; a packet arriving at a full class is dropped
+ * without touching the others, so a burst of local readings cannot
+ * crowd out relayed traffic.  Dequeue takes the head of the best
+ * non-empty class the caller allows, which lets the device fill a
+ * transmit slot with the most valuable frames it holds.
+ */
+class LwsnTxQueue : public Object
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  LwsnTxQueue ();
+
+  /// Traffic class, best first.
+  enum Class
+  {
+    ACK = 0,      //!< explicit ARQ acknowledgements
+    CODED,        //!< network-coded frames
+    FORWARD,      //!< frames relayed alone
+    ORIGINAL,     //!< the node's own readings
+    CLASSES       //!< number of classes
+  };
+
+  /**
+   * TracedCallback signature for packets dropped at a full class.
+   *
+   * \param [in] cls class of the packet, one of Class
+   * \param [in] packet the dropped packet
+   */
+  typedef void (* DropTracedCallback)(uint8_t cls, Ptr<const Packet> packet);
+
+  /**
+   * \param cls class of the packet
+   * \param packet packet to queue
+   * \return false if the class was full and the packet dropped
+   */
+  bool Enqueue (Class cls, Ptr<Packet> packet);
+
+  /**
+   * \param worst worst class that may be taken
+   * \param cls set to the class of the returned packet
+   * \return the head of the best non-empty class up to worst, or 0
+   */
+  Ptr<Packet> Dequeue (Class worst, Class &cls);
+
+  /**
+   * \param worst worst class that may be taken
+   * \return the packet Dequeue would return, left in the queue, or 0
+   */
+  Ptr<const Packet> Peek (Class worst) const;
+
+  /// \return the number of packets in all classes
+  uint32_t GetNPackets (void) const;
+
+  /**
+   * \param cls traffic class
+   * \return the number of packets in the class
+   */
+  uint32_t GetNPackets (Class cls) const;
+
+  /**
+   * \param cls traffic class
+   * \return the number of packets the class dropped so far
+   */
+  uint64_t GetDrops (Class cls) const;
+
+  /**
+   * Drop every queued packet without counting it.
+   */
+  void Clear (void);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * \param cls traffic class
+   * \return the number of packets the class may hold
+   */
+  uint32_t GetLimit (Class cls) const;
+
+  /**
+   * \param cls traffic class
+   * \return the traced number of packets in the class
+   */
+  TracedValue<uint32_t> &GetOccupancy (Class cls);
+
+  std::deque<Ptr<Packet> > m_packets[CLASSES]; //!< FIFO per class
+  uint64_t m_drops[CLASSES];                   //!< packets each class dropped
+  uint32_t m_maxAck;                           //!< limit of ACK
+  uint32_t m_maxCoded;                         //!< limit of CODED
+  uint32_t m_maxForward;                       //!< limit of FORWARD
+  uint32_t m_maxOriginal;                      //!< limit of ORIGINAL
+  TracedValue<uint32_t> m_nAck;                //!< packets in ACK
+  TracedValue<uint32_t> m_nCoded;              //!< packets in CODED
+  TracedValue<uint32_t> m_nForward;            //!< packets in FORWARD
+  TracedValue<uint32_t> m_nOriginal;           //!< packets in ORIGINAL
+  TracedCallback<uint8_t, Ptr<const Packet> > m_dropTrace; //!< drop at a full class
+};
+
+} // namespace ns3
+
+#endif /* LWSN_TX_QUEUE_H */
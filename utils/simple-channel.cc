@@ -0,0 +1,222 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2007 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
+ */
+#include <algorithm>
+#include "simple-channel.h"
+#include "simple-net-device.h"
+#include "ns3/simulator.h"
+#include "ns3/packet.h"
+#include "ns3/node.h"
+#include "ns3/log.h"
+
+namespace ns3 {
+
+NS_LOG_COMPONENT_DEFINE ("SimpleChannel");
+
+NS_OBJECT_ENSURE_REGISTERED (SimpleChannel);
+
+TypeId
+SimpleChannel::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::SimpleChannel")
+    .SetParent<Channel> ()
+    .SetGroupName("Network")
+    .AddConstructor<SimpleChannel> ()
+    .AddAttribute ("Delay", "Transmission delay through the channel",
+                   TimeValue (Seconds (0)),
+                   MakeTimeAccessor (&SimpleChannel::m_delay),
+                   MakeTimeChecker ())
+  ;
+  return tid;
+}
+
+SimpleChannel::SimpleChannel ()
+  : m_indexValid (false)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+SimpleChannel::Send (Ptr<Packet> p, uint16_t protocol,
+                     Mac48Address to, Mac48Address from,
+                     Ptr<SimpleNetDevice> sender)
+{
+  NS_LOG_FUNCTION (this << p << protocol << to << from << sender);
+
+  if (!to.IsBroadcast () && !to.IsGroup ())
+    {
+      Ptr<SimpleNetDevice> device = Find (to);
+      if (device != 0)
+        {
+          Deliver (device, p, protocol, to, from, sender);
+        }
+      // the other neighbor of the sender hears the frame too, if it listens
+      Ptr<SimpleNetDevice> left = Find (sender->GetLeftAddress ());
+      Ptr<SimpleNetDevice> right = Find (sender->GetRightAddress ());
+      if (left != 0 && left != device && left->IsOverhearing ())
+        {
+          Deliver (left, p, protocol, to, from, sender);
+        }
+      if (right != 0 && right != device && right != left && right->IsOverhearing ())
+        {
+          Deliver (right, p, protocol, to, from, sender);
+        }
+      return;
+    }
+
+  // one-hop broadcast: the two neighbors of the sender; chain ends name
+  // themselves on their open side and Deliver skips the sender
+  Ptr<SimpleNetDevice> left = Find (sender->GetLeftAddress ());
+  Ptr<SimpleNetDevice> right = Find (sender->GetRightAddress ());
+  if (to.IsBroadcast () && (left != 0 || right != 0))
+    {
+      if (left != 0)
+        {
+          Deliver (left, p, protocol, to, from, sender);
+        }
+      if (right != 0 && right != left)
+        {
+          Deliver (right, p, protocol, to, from, sender);
+        }
+      return;
+    }
+
+  for (std::vector<Ptr<SimpleNetDevice> >::const_iterator i = m_devices.begin (); i != m_devices.end (); ++i)
+    {
+      Deliver (*i, p, protocol, to, from, sender);
+    }
+}
+
+void
+SimpleChannel::Deliver (Ptr<SimpleNetDevice> device, Ptr<Packet> p, uint16_t protocol,
+                        Mac48Address to, Mac48Address from, Ptr<SimpleNetDevice> sender)
+{
+  if (device == sender)
+    {
+      return;
+    }
+  std::map<Ptr<SimpleNetDevice>, std::vector<Ptr<SimpleNetDevice> > >::const_iterator blocked =
+    m_blackListedDevices.find (device);
+  if (blocked != m_blackListedDevices.end ()
+      && std::find (blocked->second.begin (), blocked->second.end (), sender) != blocked->second.end ())
+    {
+      return;
+    }
+  if (!m_remote.IsNull () && !device->IsLocal ())
+    {
+      Ptr<Packet> copy = p->Copy ();
+      SimpleNetDevice::TagRemote (copy, protocol, to, from);
+      m_remote (copy, Simulator::Now () + m_delay, device);
+      return;
+    }
+  Simulator::ScheduleWithContext (device->GetNode ()->GetId (), m_delay,
+                                  &SimpleNetDevice::Receive, device, p->Copy (), protocol, to, from);
+}
+
+Ptr<SimpleNetDevice>
+SimpleChannel::Find (Mac48Address address)
+{
+  if (!m_indexValid)
+    {
+      Reindex ();
+    }
+  std::map<Mac48Address, Ptr<SimpleNetDevice> >::const_iterator it = m_byAddress.find (address);
+  return it == m_byAddress.end () ? 0 : it->second;
+}
+
+void
+SimpleChannel::AddressChanged (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_indexValid = false;
+}
+
+void
+SimpleChannel::SetRemoteCallback (RemoteCallback cb)
+{
+  NS_LOG_FUNCTION (this);
+  m_remote = cb;
+}
+
+void
+SimpleChannel::Reindex (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_byAddress.clear ();
+  for (std::vector<Ptr<SimpleNetDevice> >::const_iterator i = m_devices.begin (); i != m_devices.end (); ++i)
+    {
+      m_byAddress[Mac48Address::ConvertFrom ((*i)->GetAddress ())] = *i;
+    }
+  m_indexValid = true;
+}
+
+void
+SimpleChannel::Add (Ptr<SimpleNetDevice> device)
+{
+  NS_LOG_FUNCTION (this << device);
+  m_devices.push_back (device);
+  m_indexValid = false;
+}
+
+uint32_t
+SimpleChannel::GetNDevices (void) const
+{
+  NS_LOG_FUNCTION (this);
+  return m_devices.size ();
+}
+
+Ptr<NetDevice>
+SimpleChannel::GetDevice (uint32_t i) const
+{
+  NS_LOG_FUNCTION (this << i);
+  return m_devices[i];
+}
+
+void
+SimpleChannel::BlackList (Ptr<SimpleNetDevice> from, Ptr<SimpleNetDevice> to)
+{
+  if (m_blackListedDevices.find (to) != m_blackListedDevices.end ())
+    {
+      if (find (m_blackListedDevices[to].begin (), m_blackListedDevices[to].end (), from) ==
+          m_blackListedDevices[to].end () )
+        {
+          m_blackListedDevices[to].push_back (from);
+        }
+    }
+  else
+    {
+      m_blackListedDevices[to].push_back (from);
+    }
+}
+
+void
+SimpleChannel::UnBlackList (Ptr<SimpleNetDevice> from, Ptr<SimpleNetDevice> to)
+{
+  if (m_blackListedDevices.find (to) != m_blackListedDevices.end ())
+    {
+      std::vector<Ptr<SimpleNetDevice> >::iterator iter;
+      iter = find (m_blackListedDevices[to].begin (), m_blackListedDevices[to].end (), from);
+      if (iter != m_blackListedDevices[to].end () )
+        {
+          m_blackListedDevices[to].erase (iter);
+        }
+    }
+}
+
+} // namespace ns3
@@ -0,0 +1,169 @@
+/* -*- Mode:C++; c-file-style:"gnu"; indent-tabs-mode:nil; -*- */
+/*
+ * Copyright (c) 2007 INRIA
+ *
+ * This program is free software; you can redistribute it and/or modify
+ * it under the terms of the GNU General Public License version 2 as
+ * published by the Free Software Foundation;
+ *
+ * This program is distributed in the hope that it will be useful,
+ * but WITHOUT ANY WARRANTY; without even the implied warranty of
+ * MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ * GNU General Public License for more details.
+ *
+ * You should have received a copy of the GNU General Public License
+ * along with this program; if not, write to the Free Software
+ * Foundation, Inc., 59 Temple Place, Suite 330, Boston, MA  02111-1307  USA
+ *
+ * Author: Mathieu Lacage <mathieu.lacage@sophia.inria.fr>
+ */
+#ifndef SIMPLE_CHANNEL_H
+#define SIMPLE_CHANNEL_H
+
+#include "ns3/channel.h"
+#include "ns3/nstime.h"
+#include "ns3/callback.h"
+#include "mac48-address.h"
+#include <vector>
+#include <map>
+
+namespace ns3 {
+
+class SimpleNetDevice;
+class Packet;
+
+/**
+ * \ingroup channel
+ * \brief A simple channel, for simple things and testing.
+ *
+ * This channel doesn't check for packet collisions and it
+ * does not introduce any error.
+ * By default, it does not add any delay to the packets.
+ * Furthermore, it assumes that the associated NetDevices
+ * are using 48-bit MAC addresses.
+ *
+ * Unicast packets are delivered to the device owning the destination
+ * address, found through an address index, and to those neighbors of
+ * the sender that overhear (SimpleNetDevice::IsOverhearing).
+ * Broadcast packets reach the left and right neighbors of the sender,
+ * as set with SimpleNetDevice::SetSideAddress, so that a send costs
+ * O(log N) instead of a copy per attached device.  Broadcasts from a device
+ * without neighbors reach every device, as before.
+ *
+ * In a partitioned run, packets for devices simulated in another
+ * partition are handed to the remote callback, tagged with
+ * SimpleNetDevice::TagRemote, together with their arrival time.  The
+ * channel Delay is then the lookahead of the partitions and must be
+ * positive; any Delay below one slot of the LwsnSlotSchedule leaves
+ * the slot each packet arrives in unchanged.
+ *
+ * This channel is meant to be used by ns3::SimpleNetDevices only.
+ */
+class SimpleChannel : public Channel
+{
+public:
+  /**
+   * \brief Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+  SimpleChannel ();
+
+  /**
+   * A packet is sent by a net device.  A receive event will be
+   * scheduled for the destination device, or for the neighbors of the
+   * sender if the destination is the broadcast address.
+   *
+   * \param p packet to be sent
+   * \param protocol protocol number
+   * \param to address to send packet to
+   * \param from address the packet is coming from
+   * \param sender netdevice who sent the packet
+   *
+   */
+  virtual void Send (Ptr<Packet> p, uint16_t protocol, Mac48Address to, Mac48Address from,
+                     Ptr<SimpleNetDevice> sender);
+
+  /**
+   * Attached a net device to the channel.
+   *
+   * \param device the device to attach to the channel
+   */
+  virtual void Add (Ptr<SimpleNetDevice> device);
+
+  /**
+   * Tell the channel that an attached device changed its address.
+   */
+  void AddressChanged (void);
+
+  /**
+   * Callback for packets to devices of other partitions: the tagged
+   * packet, its arrival time and the receiving device.
+   */
+  typedef Callback<void, Ptr<Packet>, Time, Ptr<SimpleNetDevice> > RemoteCallback;
+
+  /**
+   * \param cb callback that carries packets to devices whose node is
+   *        simulated in another partition
+   */
+  void SetRemoteCallback (RemoteCallback cb);
+
+  /**
+   * Blocks the communications from a NetDevice to another NetDevice.
+   * The block is unidirectional
+   *
+   * \param from the device to BlackList
+   * \param to the device wanting to block the other one
+   */
+  virtual void BlackList (Ptr<SimpleNetDevice> from, Ptr<SimpleNetDevice> to);
+
+  /**
+   * Un-Blocks the communications from a NetDevice to another NetDevice.
+   * The block is unidirectional
+   *
+   * \param from the device to BlackList
+   * \param to the device wanting to block the other one
+   */
+  virtual void UnBlackList (Ptr<SimpleNetDevice> from, Ptr<SimpleNetDevice> to);
+
+  // inherited from ns3::Channel
+  virtual uint32_t GetNDevices (void) const;
+  virtual Ptr<NetDevice> GetDevice (uint32_t i) const;
+
+private:
+  /**
+   * Schedule the reception of a copy of p at device, unless device is
+   * the sender or blacklisted the sender.
+   *
+   * \param device the receiving device
+   * \param p packet to be sent
+   * \param protocol protocol number
+   * \param to address to send packet to
+   * \param from address the packet is coming from
+   * \param sender netdevice who sent the packet
+   */
+  void Deliver (Ptr<SimpleNetDevice> device, Ptr<Packet> p, uint16_t protocol,
+                Mac48Address to, Mac48Address from, Ptr<SimpleNetDevice> sender);
+
+  /**
+   * \param address a MAC address
+   * \return the attached device owning the address, or 0
+   */
+  Ptr<SimpleNetDevice> Find (Mac48Address address);
+
+  /**
+   * Rebuild m_byAddress from the current device addresses.
+   */
+  void Reindex (void);
+
+  Time m_delay; //!< The assigned speed-of-light delay of the channel
+  RemoteCallback m_remote; //!< carries packets to other partitions
+  std::vector<Ptr<SimpleNetDevice> > m_devices; //!< devices connected by the channel
+  std::map<Mac48Address, Ptr<SimpleNetDevice> > m_byAddress; //!< devices by address
+  bool m_indexValid; //!< false after a device was added or readdressed since the last Reindex
+  std::map<Ptr<SimpleNetDevice>, std::vector<Ptr<SimpleNetDevice> > > m_blackListedDevices; //!< devices blocked on a device
+};
+
+} // namespace ns3
+
+#endif /* SIMPLE_CHANNEL_H */
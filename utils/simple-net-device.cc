@@ -29,12 +29,42 @@
 #include "ns3/string.h"
 #include "ns3/tag.h"
 #include "ns3/simulator.h"
-#include "ns3/drop-tail-queue.h"
+#include "lwsn-slot-schedule.h"
+#include "lwsn-coding.h"
+#include "lwsn-coding-header.h"
+#include "lwsn-rlnc-header.h"
+#include "lwsn-trace.h"
+#include "lwsn-packet-pool.h"
+#include "lwsn-reading-header.h"
+#include "lwsn-aggregate-header.h"
+#include "ns3/enum.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/abort.h"
+#include <algorithm>
+#include <cstring>
 
 namespace ns3 {
 
 NS_LOG_COMPONENT_DEFINE ("SimpleNetDevice");
 
+/// Weight of the latest frame in the per-flow arrival estimate.
+static const double g_flowRateGain = 0.125;
+
+#ifdef NS3_LWSN_TRACE
+/**
+ * \param p a packet starting with its LwsnHeader
+ * \return the origin sid of the packet, for trace records
+ */
+static uint16_t
+PeekOsid (Ptr<const Packet> p)
+{
+  LwsnFrameHeader header;
+  p->PeekHeader (header);
+  return header.GetOsid ();
+}
+#endif
+
 /**
  * \brief SimpleNetDevice tag to store source, destination and protocol of each packet.
  */
@@ -200,16 +230,153 @@ SimpleNetDevice::GetTypeId (void)
                    BooleanValue (false),
                    MakeBooleanAccessor (&SimpleNetDevice::m_pointToPointMode),
                    MakeBooleanChecker ())
+    .AddAttribute ("TxClassQueue",
+                   "The queue the device fills its transmit slots from: "
+                   "acknowledgements first, then coded frames, then relayed "
+                   "ones, then the node's own.",
+                   StringValue ("ns3::LwsnTxQueue"),
+                   MakePointerAccessor (&SimpleNetDevice::m_txQueue),
+                   MakePointerChecker<LwsnTxQueue> ())
     .AddAttribute ("TxQueue",
-                   "A queue to use as the transmit queue in the device.",
-                   StringValue ("ns3::DropTailQueue"),
-                   MakePointerAccessor (&SimpleNetDevice::m_queue),
-                   MakePointerChecker<Queue> ())
+                   "The device sends from its TxClassQueue.",
+                   TypeId::ATTR_SGC,
+                   EmptyAttributeValue (),
+                   MakeEmptyAttributeAccessor (),
+                   MakeEmptyAttributeChecker (),
+                   TypeId::OBSOLETE,
+                   "set ns3::SimpleNetDevice::TxClassQueue, an ns3::LwsnTxQueue, instead")
     .AddAttribute ("DataRate",
-                   "The default data rate for point to point links. Zero means infinite",
-                   DataRateValue (DataRate ("0b/s")),
-                   MakeDataRateAccessor (&SimpleNetDevice::m_bps),
-                   MakeDataRateChecker ())
+                   "The slot schedule sets the radio rate of all devices.",
+                   TypeId::ATTR_SGC,
+                   EmptyAttributeValue (),
+                   MakeEmptyAttributeAccessor (),
+                   MakeEmptyAttributeChecker (),
+                   TypeId::OBSOLETE,
+                   "set ns3::LwsnSlotSchedule::DataRate instead")
+    .AddAttribute ("Theta",
+                   "Smallest estimated chance that the partner flow arrives in "
+                   "the next frame for which a relay holds a lone packet one "
+                   "more frame to code it; above 1 a lone packet is always "
+                   "forwarded in its slot.",
+                   DoubleValue (0.1),
+                   MakeDoubleAccessor (&SimpleNetDevice::m_theta),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("ArqMaxRetransmissions",
+                   "Times a relay or origin sends a packet again when its next "
+                   "hop does not acknowledge it within a frame; 0 turns "
+                   "hop-by-hop ARQ off.  Needs XOR coding and readings that "
+                   "start with an LwsnReadingHeader.",
+                   UintegerValue (0),
+                   MakeUintegerAccessor (&SimpleNetDevice::m_arqMaxRetransmissions),
+                   MakeUintegerChecker<uint32_t> (0, 255))
+    .AddAttribute ("Aggregation",
+                   "Pack the readings an origin takes before its slot, and the "
+                   "packets of one flow a relay sends in the same slot, into "
+                   "frames of at most Mtu bytes.  All devices of a chain have "
+                   "to agree; needs XOR coding.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&SimpleNetDevice::m_aggregation),
+                   MakeBooleanChecker ())
+    .AddAttribute ("Mtu",
+                   "Largest frame the device sends, in bytes; with a slot "
+                   "schedule of non-zero DataRate at most what leaves room "
+                   "to code the frame within its MaxFrameSize.",
+                   UintegerValue (0xffff),
+                   MakeUintegerAccessor (&SimpleNetDevice::m_mtu),
+                   MakeUintegerChecker<uint16_t> ())
+    .AddAttribute ("SlotCapacity",
+                   "Most queued frames sent in a slot the device transmits in, "
+                   "within the slot's airtime.  The slot table plans one frame "
+                   "per slot, a reading or a coded pair both neighbors hear; "
+                   "more let a backlog drain faster.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&SimpleNetDevice::m_slotCapacity),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("SlotSchedule",
+                   "The TDMA slot table the device sends by.",
+                   PointerValue (),
+                   MakePointerAccessor (&SimpleNetDevice::m_schedule),
+                   MakePointerChecker<LwsnSlotSchedule> ())
+    .AddAttribute ("CodingMode",
+                   "How relays combine packets: pairwise XOR or random linear "
+                   "network coding over GF(2^8).",
+                   EnumValue (SimpleNetDevice::XOR_CODING),
+                   MakeEnumAccessor (&SimpleNetDevice::m_codingMode),
+                   MakeEnumChecker (SimpleNetDevice::XOR_CODING, "Xor",
+                                    SimpleNetDevice::RLNC_CODING, "Rlnc"))
+    .AddAttribute ("RlncGenerationSize",
+                   "Number of origin sids coded together in one RLNC generation.",
+                   UintegerValue (4),
+                   MakeUintegerAccessor (&SimpleNetDevice::m_rlncK),
+                   MakeUintegerChecker<uint32_t> (1, 255))
+    .AddAttribute ("RlncSymbolSize",
+                   "Bytes per RLNC symbol: a 2-byte length, the payload and zero padding.",
+                   UintegerValue (128),
+                   MakeUintegerAccessor (&SimpleNetDevice::m_rlncSymbolSize),
+                   MakeUintegerChecker<uint32_t> (3, 0xffff))
+    .AddAttribute ("RlncMaxGenerations",
+                   "Number of RLNC generations a device keeps; the oldest is dropped first.",
+                   UintegerValue (64),
+                   MakeUintegerAccessor (&SimpleNetDevice::m_rlncMaxGenerations),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("CodingBufferDepth",
+                   "Packets per origin sid kept for coding partners and for decoding.",
+                   UintegerValue (4),
+                   MakeUintegerAccessor (&SimpleNetDevice::m_codingBufferDepth),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("CodingBufferMaxAge",
+                   "Frames a buffered packet stays usable for coding or decoding.",
+                   UintegerValue (2),
+                   MakeUintegerAccessor (&SimpleNetDevice::m_codingBufferMaxAge),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("RadioSleep",
+                   "Put the radio to sleep in slots in which the device neither "
+                   "transmits nor listens; otherwise it idles.",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&SimpleNetDevice::m_radioSleep),
+                   MakeBooleanChecker ())
+    .AddAttribute ("SupplyVoltage",
+                   "Radio supply voltage in volts.",
+                   DoubleValue (3.0),
+                   MakeDoubleAccessor (&SimpleNetDevice::m_supplyVoltage),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("TxCurrent",
+                   "Radio current draw while transmitting, in amperes.",
+                   DoubleValue (0.0174),
+                   MakeDoubleAccessor (&SimpleNetDevice::m_txCurrent),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("RxCurrent",
+                   "Radio current draw while listening, in amperes.",
+                   DoubleValue (0.0197),
+                   MakeDoubleAccessor (&SimpleNetDevice::m_rxCurrent),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("IdleCurrent",
+                   "Radio current draw while idle, in amperes.",
+                   DoubleValue (0.000426),
+                   MakeDoubleAccessor (&SimpleNetDevice::m_idleCurrent),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("SleepCurrent",
+                   "Radio current draw while asleep, in amperes.",
+                   DoubleValue (0.00002),
+                   MakeDoubleAccessor (&SimpleNetDevice::m_sleepCurrent),
+                   MakeDoubleChecker<double> (0.0))
+    .AddTraceSource ("RadioState",
+                     "The radio left a state: start, duration and the state.",
+                     MakeTraceSourceAccessor (&SimpleNetDevice::m_radioStateTrace),
+                     "ns3::SimpleNetDevice::RadioStateTracedCallback")
+    .AddTraceSource ("TotalEnergyConsumption",
+                     "Energy in joules the radio spent so far.",
+                     MakeTraceSourceAccessor (&SimpleNetDevice::m_totalEnergy),
+                     "ns3::TracedValueCallback::Double")
+    .AddTraceSource ("Deliver",
+                     "A sink received a reading: origin sid, sequence number "
+                     "and payload size.",
+                     MakeTraceSourceAccessor (&SimpleNetDevice::m_deliverTrace),
+                     "ns3::SimpleNetDevice::DeliverTracedCallback")
+    .AddTraceSource ("RelayBacklog",
+                     "Packets of other nodes held by this relay until its slot.",
+                     MakeTraceSourceAccessor (&SimpleNetDevice::m_relayBacklog),
+                     "ns3::TracedValueCallback::Uint32")
     .AddTraceSource ("PhyRxDrop",
                      "Trace source indicating a packet has been dropped "
                      "by the device during reception",
@@ -224,17 +391,36 @@ SimpleNetDevice::SimpleNetDevice ()
     m_node (0),
     m_mtu (0xffff),
     m_ifIndex (0),
+    m_sid (0),
+    m_codingBufferDepth (4),
+    m_codingBufferMaxAge (2),
+    m_theta (0.1),
+    m_codingMode (XOR_CODING),
+    m_rlncK (4),
+    m_rlncSymbolSize (128),
+    m_rlncMaxGenerations (64),
+    m_slotCapacity (1),
+    m_servedClock (~(uint64_t)0),
+    m_aggregation (false),
+    m_radioState (RADIO_IDLE),
+    m_radioSleep (true),
+    m_supplyVoltage (3.0),
+    m_txCurrent (0.0174),
+    m_rxCurrent (0.0197),
+    m_idleCurrent (0.000426),
+    m_sleepCurrent (0.00002),
+    m_totalEnergy (0.0),
+    m_relayBacklog (0),
+    m_arqMaxRetransmissions (0),
     m_linkUp (false)
 {
   NS_LOG_FUNCTION (this);
-  timeslot=13;
-  m_rxPacket = 0;
-  m_rxPacket_1 = 0;
-  m_txPacket = 0;
-  m_txPacket_1 = 0;
-  nc_flag_1 = false;
-  nc_flag_2 = false;
-  theta = 0.1;
+  for (uint32_t i = 0; i < RADIO_STATES; ++i)
+    {
+      m_stateEnergy[i] = 0.0;
+    }
+  m_schedule = CreateObject<LwsnSlotSchedule> ();
+  m_rlncRng = CreateObject<UniformRandomVariable> ();
 }
 
 void
@@ -253,108 +439,111 @@ SimpleNetDevice::SetSideAddress(Address laddress, Address raddress){
   r_address=Mac48Address::ConvertFrom (raddress);
 }
 
+Mac48Address
+SimpleNetDevice::GetLeftAddress(void) const{
+  return l_address;
+}
+
+Mac48Address
+SimpleNetDevice::GetRightAddress(void) const{
+  return r_address;
+}
+
 void
 SimpleNetDevice::Receive (Ptr<Packet> packet, uint16_t protocol,
                           Mac48Address to, Mac48Address from)
 {
 
-  if (m_receiveErrorModel && m_receiveErrorModel->IsCorrupt (packet) )
+  // a one-hop broadcast from a neighbor is meant for this device as much
+  // as for the other neighbor; the header tells what it carries here
+  bool addressed = to == m_address
+    || (to.IsBroadcast () && (from == l_address || from == r_address));
+
+  if (m_radioState == RADIO_SLEEP)
     {
-      m_phyRxDropTrace (packet);
+      if (addressed)
+        {
+          LWSN_TRACE (LwsnTrace::DROP, m_sid, PeekOsid (packet), 0, packet->GetSize ());
+          m_phyRxDropTrace (packet);
+        }
       return;
     }
 
-  if (to == m_address)   
-    { 
-      // gateway send !!!!!!!!!!1
-      if(this->GetSid()==1||this->GetSid()==6){
-      	NS_LOG_UNCOND("Sid"<<this->GetSid()<<"Receive");
-      }
-      else{
-        LwsnHeader receiveHeader;
-      	packet->PeekHeader(receiveHeader);
-        NS_LOG_FUNCTION ("SID  : " <<this->GetSid() << "from->"  <<from << "   Osid->"<<receiveHeader.GetOsid());
-
-        if(receiveHeader.GetType() == LwsnHeader::ORIGINAL_TRANSMISSION){
-          SendSchedule(packet,to,from,protocol,receiveHeader);
-        }
-        else if(receiveHeader.GetType() == LwsnHeader::FORWARDING){
-          SendSchedule(packet,to,from,protocol,receiveHeader);
+  if (m_receiveErrorModel && m_receiveErrorModel->IsCorrupt (packet) )
+    {
+      if (addressed)
+        {
+          LWSN_TRACE (LwsnTrace::DROP, m_sid, PeekOsid (packet), 0, packet->GetSize ());
+          m_phyRxDropTrace (packet);
         }
-        else if(receiveHeader.GetType() == LwsnHeader::NETWORK_CODING){
-          Ptr<Packet> p = decoding(packet);
-          p->PeekHeader(receiveHeader);
+      return;
+    }
 
-          SendSchedule(p,to,from,protocol,receiveHeader);
+  // a unicast between two neighbors, overheard as the implicit
+  // acknowledgement of what this device sent the one forwarding it;
+  // coded frames are broadcast to both neighbors anyway
+  if (!addressed && !to.IsBroadcast () && !to.IsGroup ())
+    {
+      LwsnFrameHeader overheard;
+      packet->PeekHeader (overheard);
+      if (IsOverhearing () && overheard.GetType () != LwsnHeader::NETWORK_CODING)
+        {
+          ArqAcknowledge (packet, overheard, from);
         }
-  		}
+      return;
     }
- /* else if (to.IsBroadcast ())
+
+  if (!addressed)
     {
-      packetType = NetDevice::PACKET_BROADCAST;
+      return;
     }
-  else if (to.IsGroup ())
+  LWSN_TRACE (LwsnTrace::RX, m_sid, PeekOsid (packet), 0, packet->GetSize ());
+
+  if (m_codingMode == RLNC_CODING)
     {
-      packetType = NetDevice::PACKET_MULTICAST;
+      RlncReceive (packet);
+      return;
     }
-  else 
+
+  LwsnFrameHeader receiveHeader;
+  packet->PeekHeader (receiveHeader);
+  if (IsOverhearing () && ArqAcknowledge (packet, receiveHeader, from)
+      && receiveHeader.GetType () != LwsnHeader::NETWORK_CODING)
     {
-      packetType = NetDevice::PACKET_OTHERHOST;
+      // an explicit acknowledgement, nothing to relay
+      return;
     }
-
-  if (packetType != NetDevice::PACKET_OTHERHOST)
+  Ptr<Packet> p = packet;
+  if (receiveHeader.GetType () == LwsnHeader::NETWORK_CODING)
     {
-      m_rxCallback (this, packet, protocol, from);
+      // decoding replaces receiveHeader with the decoded packet's header
+      p = decoding (packet, receiveHeader);
+      if (p == packet)
+        {
+          // neither flow is known here, the coded packet is useless
+          return;
+        }
     }
-
-  if (!m_promiscCallback.IsNull ())
+  else if (!IsSink () && receiveHeader.GetType () != LwsnHeader::ORIGINAL_TRANSMISSION
+           && receiveHeader.GetType () != LwsnHeader::FORWARDING)
     {
-      m_promiscCallback (this, packet, protocol, from, to, packetType);
+      // relays only carry readings on
+      return;
+    }
+  if (!ArqAccept (p, receiveHeader, from))
+    {
+      return;
+    }
+  if (IsSink ())
+    {
+      DeliverFrame (p, receiveHeader);
+    }
+  else
+    {
+      SendSchedule (p, to, from, protocol, receiveHeader);
     }
-    */
-}
-
-void
-SimpleNetDevice::SetRxPacket(Ptr<Packet> p)
-{
-  m_rxPacket = p;
-}
-
-Ptr<Packet>
-SimpleNetDevice::GetRxPacket(void) const
-{
-  return m_rxPacket;
-}
-void
-SimpleNetDevice::SetRxPacket_1(Ptr<Packet> p)
-{
-  m_rxPacket_1 = p;
-}
-
-Ptr<Packet>
-SimpleNetDevice::GetRxPacket_1(void) const
-{
-  return m_rxPacket_1;
-}
-
-void
-SimpleNetDevice::SetTxPacket(Ptr<Packet> p){
-  m_txPacket = p;
-}
-
-Ptr<Packet>
-SimpleNetDevice::GetTxPacket(void) const{
-  return m_txPacket;
-}
-void
-SimpleNetDevice::SetTxPacket_1(Ptr<Packet> p){
-  m_txPacket_1 = p;
 }
 
-Ptr<Packet>
-SimpleNetDevice::GetTxPacket_1(void) const{
-  return m_txPacket_1;
-}
 void 
 SimpleNetDevice::SetChannel (Ptr<SimpleChannel> channel)
 {
@@ -365,18 +554,25 @@ SimpleNetDevice::SetChannel (Ptr<SimpleChannel> channel)
   m_linkChangeCallbacks ();
 }
 
+void
+SimpleNetDevice::SetQueue (Ptr<Queue> q)
+{
+  NS_LOG_FUNCTION (this << q);
+  NS_ABORT_MSG ("SimpleNetDevice::SetQueue is obsolete; the device sends from "
+                "the ns3::LwsnTxQueue of its TxClassQueue attribute");
+}
+
 Ptr<Queue>
 SimpleNetDevice::GetQueue () const
 {
-  NS_LOG_FUNCTION (this);
-  return m_queue;
+  NS_ABORT_MSG ("SimpleNetDevice::GetQueue is obsolete; use GetTxClassQueue");
+  return 0;
 }
 
-void
-SimpleNetDevice::SetQueue (Ptr<Queue> q)
+Ptr<LwsnTxQueue>
+SimpleNetDevice::GetTxClassQueue () const
 {
-  NS_LOG_FUNCTION (this << q);
-  m_queue = q;
+  return m_txQueue;
 }
 
 void
@@ -409,6 +605,10 @@ SimpleNetDevice::SetAddress (Address address)
 {
   NS_LOG_FUNCTION (this << address);
   m_address = Mac48Address::ConvertFrom (address);
+  if (m_channel != 0)
+    {
+      m_channel->AddressChanged ();
+    }
 }
 Address 
 SimpleNetDevice::GetAddress (void) const
@@ -504,14 +704,32 @@ SimpleNetDevice::IsBridge (void) const
 Ptr<Packet>
 SimpleNetDevice::encoding(Ptr<Packet> p1,Ptr<Packet> p2)
 {
-  LwsnHeader temp1;
-  p1 -> RemoveHeader(temp1);
-
-  LwsnHeader temp2;
-  p2 -> RemoveHeader(temp2);
-
-  Ptr<Packet> ncpacket = Create<Packet> (100);
-  LwsnHeader ncHeader;
+  // the inputs are left untouched: copy them whole and skip the headers
+  LwsnFrameHeader temp1;
+  uint32_t skip1 = p1->PeekHeader(temp1);
+  LwsnFrameHeader temp2;
+  uint32_t skip2 = p2->PeekHeader(temp2);
+  uint32_t seq1 = PeekSequence(p1,skip1);
+  uint32_t seq2 = PeekSequence(p2,skip2);
+
+  // XOR the payloads, the shorter one zero padded to the longer
+  uint32_t len1 = p1->GetSize() - skip1;
+  uint32_t len2 = p2->GetSize() - skip2;
+  uint32_t len = std::max(len1,len2);
+  m_codingBuffer.resize(skip1 + len + 1);
+  m_codingScratch.resize(skip2 + len + 1);
+  p1->CopyData(&m_codingBuffer[0],skip1 + len1);
+  std::memset(&m_codingBuffer[skip1 + len1],0,len - len1);
+  p2->CopyData(&m_codingScratch[0],skip2 + len2);
+  LwsnCoding::Xor(&m_codingBuffer[skip1],&m_codingScratch[skip2],len2);
+
+  Ptr<Packet> ncpacket = LwsnPacketPool::Get ().Acquire (&m_codingBuffer[skip1],len);
+  LwsnCodingHeader flows;
+  flows.AddFlow(len1,seq1);
+  flows.AddFlow(len2,seq2);
+  ncpacket->AddHeader(flows);
+
+  LwsnFrameHeader ncHeader;
 
   ncHeader.SetType(LwsnHeader::NETWORK_CODING);
   ncHeader.SetOsid(temp1.GetOsid());
@@ -523,465 +741,1226 @@ SimpleNetDevice::encoding(Ptr<Packet> p1,Ptr<Packet> p2)
 
   ncpacket->AddHeader(ncHeader);
 
-  NS_LOG_FUNCTION("Sid : "<<this->GetSid()<< "  packet encoding, get Osid_1 -> "<<ncHeader.GetOsid() << "Osid_2 ->"<<ncHeader.GetOsid2());
+  LWSN_TRACE (LwsnTrace::ENCODE, m_sid, ncHeader.GetOsid (), ncHeader.GetOsid2 (), ncpacket->GetSize ());
 
   return ncpacket;
 }
 
 Ptr<Packet>
-SimpleNetDevice::decoding(Ptr<Packet> p)
+SimpleNetDevice::FindSent(uint16_t osid,uint32_t seq)
 {
+  return m_txBuffer.Find(osid,seq,CurrentFrame());
+}
 
-  Ptr<Packet> t = GetTxPacket();
-  LwsnHeader temp1;
-  t -> PeekHeader(temp1);
+void
+SimpleNetDevice::RememberSent(Ptr<Packet> p)
+{
+  LwsnFrameHeader header;
+  p->PeekHeader(header);
+  RememberSent(p,header);
+}
 
-  Ptr<Packet> t1 = GetTxPacket_1();
-  LwsnHeader temp3;
-  t1 -> PeekHeader(temp3);
+void
+SimpleNetDevice::RememberSent(Ptr<Packet> p,const LwsnFrameHeader &header)
+{
+  m_txBuffer.Insert(header.GetOsid(),PeekSequence(p,header.GetSerializedSize()),p,CurrentFrame());
+}
 
-  LwsnHeader temp2;
-  p -> RemoveHeader(temp2);
+void
+SimpleNetDevice::RewriteForwardingHeader(Ptr<Packet> p,LwsnFrameHeader &header)
+{
+  // drop the old bytes unparsed and serialize the patched view over them;
+  // the buffer is reused in place unless it is shared with another packet
+  uint32_t size = header.GetSerializedSize();
+  header.SetType(LwsnHeader::FORWARDING);
+  header.SetPsid(m_sid);
+  header.SetE(0);
+  p->RemoveAtStart(size);
+  p->AddHeader(header);
+}
+
+uint64_t
+SimpleNetDevice::CurrentFrame(void) const
+{
+  return m_schedule->GetFrame(SlotClock());
+}
 
-  if(temp1.GetOsid() == temp2.GetOsid()){
-    Ptr<Packet> packet = Create<Packet> (100);
-    LwsnHeader sendHeader;
+uint64_t
+SimpleNetDevice::SlotClock(void) const
+{
+  return m_schedule->GetSlotClock(Simulator::Now());
+}
 
-    sendHeader.SetType(LwsnHeader::FORWARDING);
-    sendHeader.SetOsid(temp2.GetOsid2());
-    sendHeader.SetPsid(m_sid);
-    sendHeader.SetE(0);
+Time
+SimpleNetDevice::UntilSlot(uint64_t clock) const
+{
+  Time start = m_schedule->GetSlotTime(clock);
+  return start > Simulator::Now() ? start - Simulator::Now() : Time(0);
+}
 
-    packet->AddHeader(sendHeader);
-    NS_LOG_FUNCTION("Sid : "<<this->GetSid()<< "  packet decoding, get Osid -> "<<sendHeader.GetOsid());
+const LwsnSlotSchedule::Entry &
+SimpleNetDevice::ScheduleEntry(uint16_t osid)
+{
+  return m_schedule->GetRoute(m_sid,osid);
+}
 
-    return packet;
+Ptr<Packet>
+SimpleNetDevice::decoding(Ptr<Packet> p,LwsnFrameHeader &header)
+{
+  const LwsnFrameHeader temp2 = header;
+  Ptr<Packet> coded = p->Copy();
+  coded->RemoveAtStart(temp2.GetSerializedSize());
+  LwsnCodingHeader flows;
+  coded->RemoveHeader(flows);
+
+  // the receiver sent one of the two packets itself; XOR exactly that
+  // one back out, a later packet of the same flow would garble the result
+  uint16_t osids[2] = { temp2.GetOsid(), temp2.GetOsid2() };
+  Ptr<Packet> known = 0;
+  uint8_t knownIndex = 0;
+  for(uint8_t i = 0; i < 2 && i < flows.GetNFlows() && known == 0; ++i){
+    known = FindSent(osids[i],flows.GetSequence(i));
+    knownIndex = i;
   }
-  else if(temp1.GetOsid() == temp2.GetOsid2()){
-    Ptr<Packet> packet = Create<Packet> (100);
-    LwsnHeader sendHeader;
+  LwsnFrameHeader knownHeader;
+  uint32_t skip = known != 0 ? known->PeekHeader(knownHeader) : 0;
+  if(known == 0 || known->GetSize() - skip != flows.GetLength(knownIndex)){
+    LWSN_TRACE (LwsnTrace::DROP, m_sid, temp2.GetOsid (), temp2.GetOsid2 (), p->GetSize ());
+    return p;
+  }
+  uint8_t unknownIndex = 1 - knownIndex;
+  uint16_t unknownOsid = osids[unknownIndex];
+
+  uint32_t len = coded->GetSize();
+  uint32_t knownLen = std::min(known->GetSize() - skip,len);
+  m_codingBuffer.resize(len + 1);
+  m_codingScratch.resize(skip + len + 1);
+  coded->CopyData(&m_codingBuffer[0],len);
+  known->CopyData(&m_codingScratch[0],skip + knownLen);
+  LwsnCoding::Xor(&m_codingBuffer[0],&m_codingScratch[skip],knownLen);
+
+  uint32_t unknownLen = std::min((uint32_t)flows.GetLength(unknownIndex),len);
+  Ptr<Packet> packet = LwsnPacketPool::Get ().Acquire (&m_codingBuffer[0],unknownLen);
+  header = LwsnFrameHeader();
+  header.SetType(LwsnHeader::FORWARDING);
+  header.SetOsid(unknownOsid);
+  header.SetPsid(m_sid);
+  header.SetE(0);
 
-    sendHeader.SetType(LwsnHeader::FORWARDING);
-    sendHeader.SetOsid(temp2.GetOsid());
-    sendHeader.SetPsid(m_sid);
-    sendHeader.SetE(0);
+  packet->AddHeader(header);
+  LWSN_TRACE (LwsnTrace::DECODE, m_sid, unknownOsid, 0, packet->GetSize ());
 
-    packet->AddHeader(sendHeader);
-    NS_LOG_FUNCTION("Sid : "<<this->GetSid()<< "  packet decoding, get Osid -> "<<sendHeader.GetOsid());
+  return packet;
+}
 
-    return packet;
+void
+SimpleNetDevice::NetworkCoding(Ptr<Packet> packet,Ptr<Packet> partner)
+{
+  // both flows leave here; keep them so the neighbours' next coded packets can be decoded
+  RememberSent(packet);
+  RememberSent(partner);
+  Ptr<Packet> ncpacket = encoding(packet,partner);
+  if(IsOverhearing()){
+    LwsnFrameHeader header;
+    packet->PeekHeader(header);
+    ArqExpect(packet,LwsnSlotSchedule::GetDirection(m_sid,header.GetOsid()),0);
+    partner->PeekHeader(header);
+    ArqExpect(partner,LwsnSlotSchedule::GetDirection(m_sid,header.GetOsid()),0);
   }
-  else if(temp3.GetOsid() == temp2.GetOsid()){
-    Ptr<Packet> packet = Create<Packet> (100);
-    LwsnHeader sendHeader;
 
-    sendHeader.SetType(LwsnHeader::FORWARDING);
-    sendHeader.SetOsid(temp2.GetOsid2());
-    sendHeader.SetPsid(m_sid);
-    sendHeader.SetE(0);
+  EnqueueTx(LwsnTxQueue::CODED,ncpacket,Mac48Address::GetBroadcast());
+}
 
-    packet->AddHeader(sendHeader);
-    NS_LOG_FUNCTION("Sid : "<<this->GetSid()<< "  packet decoding, get Osid -> "<<sendHeader.GetOsid());
+uint64_t
+SimpleNetDevice::SessionKey(uint16_t leftOsid,uint16_t rightOsid,uint64_t deadline)
+{
+  return ((uint64_t)leftOsid << 48) | ((uint64_t)rightOsid << 32) | (deadline & 0xffffffff);
+}
 
-    return packet;
+void
+SimpleNetDevice::CodingSessionFire(uint64_t key){
+  std::map<uint64_t, CodingSession>::iterator it = m_sessions.find(key);
+  NS_ASSERT(it != m_sessions.end());
+  CodingSession session = it->second;
+  m_sessions.erase(it);
+  m_relayBacklog -= session.present[LwsnSlotSchedule::LEFT] + session.present[LwsnSlotSchedule::RIGHT];
+
+  // learn how often each flow turns up for its slot; held packets
+  // were counted in the frame they arrived in
+  for(int d = LwsnSlotSchedule::LEFT; d <= LwsnSlotSchedule::RIGHT; ++d){
+    if(session.held[d] == 0){
+      double &rate = m_flowRate[FlowKey(session.osid[d],d)];
+      rate += g_flowRateGain * ((session.present[d] ? 1.0 : 0.0) - rate);
+    }
+  }
+  ++m_statistics.codingSessions;
+
+  // a lone packet waits a frame for its partner if the partner is
+  // likely enough to come: theta trades a frame of delay against the
+  // transmission a coded pair saves
+  if(session.present[LwsnSlotSchedule::LEFT] != session.present[LwsnSlotSchedule::RIGHT]){
+    int d = session.present[LwsnSlotSchedule::LEFT] ? LwsnSlotSchedule::LEFT : LwsnSlotSchedule::RIGHT;
+    int other = 1 - d;
+    std::map<uint32_t, double>::const_iterator rate = m_flowRate.find(FlowKey(session.osid[other],other));
+    if(session.held[d] + 1u < m_codingBufferMaxAge && rate != m_flowRate.end() && rate->second >= m_theta
+       && HoldForPartner(session,d,key)){
+      return;
+    }
   }
-  else if(temp3.GetOsid() == temp2.GetOsid2()){
-    Ptr<Packet> packet = Create<Packet> (100);
-    LwsnHeader sendHeader;
 
-    sendHeader.SetType(LwsnHeader::FORWARDING);
-    sendHeader.SetOsid(temp2.GetOsid());
-    sendHeader.SetPsid(m_sid);
-    sendHeader.SetE(0);
+  uint64_t frame = CurrentFrame();
+  Ptr<Packet> left = session.present[LwsnSlotSchedule::LEFT] ?
+    m_rxBuffer.Remove(session.osid[LwsnSlotSchedule::LEFT],session.seq[LwsnSlotSchedule::LEFT],frame) : Ptr<Packet> (0);
+  Ptr<Packet> right = session.present[LwsnSlotSchedule::RIGHT] ?
+    m_rxBuffer.Remove(session.osid[LwsnSlotSchedule::RIGHT],session.seq[LwsnSlotSchedule::RIGHT],frame) : Ptr<Packet> (0);
+
+  // a flow counted present may have been evicted or aged out of the
+  // buffer while it waited for its slot
+  for(int d = LwsnSlotSchedule::LEFT; d <= LwsnSlotSchedule::RIGHT; ++d){
+    if(session.present[d] && ((d == LwsnSlotSchedule::LEFT) ? left : right) == 0){
+      ++m_statistics.bufferDrops;
+      LWSN_TRACE (LwsnTrace::DROP, m_sid, session.osid[d], 0, 0);
+    }
+  }
 
-    packet->AddHeader(sendHeader);
-    NS_LOG_FUNCTION("Sid : "<<this->GetSid()<< "  packet decoding, get Osid -> "<<sendHeader.GetOsid());
+  if(left != 0 && right != 0){
+    ++m_statistics.codingHits;
+    NetworkCoding(left,right);
+  }
+  else if(left != 0 || right != 0){
+    Ptr<Packet> p = (left != 0) ? left : right;
+    LwsnFrameHeader header;
+    p->PeekHeader(header);
+    Forwarding(p,(left != 0) ? l_address : r_address,header);
+  }
+}
 
-    return packet;
+bool
+SimpleNetDevice::HoldForPartner(const CodingSession &session,int dir,uint64_t key){
+  // the same slot one frame later
+  uint16_t frameLength = m_schedule->GetFrameLength();
+  uint64_t deadline = (key & 0xffffffff) + frameLength;
+  uint64_t next = SessionKey(session.osid[LwsnSlotSchedule::LEFT],session.osid[LwsnSlotSchedule::RIGHT],deadline);
+  std::map<uint64_t, CodingSession>::iterator it = m_sessions.find(next);
+  if(it == m_sessions.end()){
+    CodingSession later = session;
+    later.state = CodingSession::WAITING;
+    later.present[1 - dir] = false;
+    later.held[1 - dir] = 0;
+    later.deadline = Simulator::Schedule(m_schedule->GetSlotTime(frameLength),&SimpleNetDevice::CodingSessionFire,this,next);
+    it = m_sessions.insert(std::make_pair(next,later)).first;
+  }
+  else if(it->second.present[dir]){
+    return false;
   }
+  it->second.present[dir] = true;
+  it->second.seq[dir] = session.seq[dir];
+  it->second.held[dir] = session.held[dir] + 1;
+  if(it->second.present[LwsnSlotSchedule::LEFT] && it->second.present[LwsnSlotSchedule::RIGHT]){
+    it->second.state = CodingSession::READY;
+  }
+  ++m_relayBacklog;
+  ++m_statistics.heldPackets;
+  m_statistics.holdSlots += frameLength;
+  return true;
+}
 
-  return p;
+uint32_t
+SimpleNetDevice::FlowKey(uint16_t osid,int dir){
+  return ((uint32_t)osid << 1) | dir;
 }
 
 void
-SimpleNetDevice::NetworkCoding(Ptr<Packet> packet)
-{
-  Ptr<Packet> ncpacket;
-  int time = Simulator::Now().GetSeconds();
-  if(time % timeslot <= 6){
-    ncpacket = encoding(packet,GetRxPacket());
-    SetRxPacket(0);
+SimpleNetDevice::ArqExpect(Ptr<Packet> p,int dir,uint8_t tries){
+  LwsnFrameHeader header;
+  uint32_t headerSize = p->PeekHeader(header);
+  ArqEntry entry;
+  entry.packet = p;
+  entry.osid = header.GetOsid();
+  entry.seq = PeekSequence(p,headerSize);
+  entry.dir = dir;
+  entry.tries = tries;
+
+  // the next hop sends the flow on within a frame unless it was lost;
+  // everything due in the same slot is resent together
+  uint16_t frameLength = m_schedule->GetFrameLength();
+  uint64_t due = SlotClock() + frameLength;
+  std::map<uint64_t, ArqSlot>::iterator it = m_arqSlots.find(due);
+  if(it == m_arqSlots.end()){
+    it = m_arqSlots.insert(std::make_pair(due,ArqSlot())).first;
+    it->second.event = Simulator::Schedule(UntilSlot(due),&SimpleNetDevice::ArqResend,this,due);
+  }
+  it->second.entries.push_back(entry);
+}
+
+void
+SimpleNetDevice::ArqResend(uint64_t due){
+  std::map<uint64_t, ArqSlot>::iterator it = m_arqSlots.find(due);
+  NS_ASSERT(it != m_arqSlots.end());
+  std::vector<ArqEntry> entries;
+  entries.swap(it->second.entries);
+  m_arqSlots.erase(it);
+
+  // a left-bound and a right-bound packet that this relay got from the
+  // other side are known to the neighbor each is not meant for, so one
+  // coded frame repairs both links while that neighbor still has its copy
+  int pair[2] = { -1, -1 };
+  for(uint32_t i = 0; i < entries.size(); ++i){
+    ArqEntry &entry = entries[i];
+    if(entry.tries >= m_arqMaxRetransmissions){
+      LWSN_TRACE (LwsnTrace::DROP, m_sid, entry.osid, 0, entry.packet->GetSize ());
+      ++m_statistics.arqGiveUps;
+      entry.packet = 0;
+      continue;
+    }
+    ++entry.tries;
+    if(entry.osid != m_sid && pair[entry.dir] < 0 && entry.tries < m_codingBufferMaxAge){
+      pair[entry.dir] = i;
+    }
+  }
+  if(pair[LwsnSlotSchedule::LEFT] >= 0 && pair[LwsnSlotSchedule::RIGHT] >= 0){
+    ArqEntry &left = entries[pair[LwsnSlotSchedule::LEFT]];
+    ArqEntry &right = entries[pair[LwsnSlotSchedule::RIGHT]];
+    Ptr<Packet> ncpacket = encoding(left.packet,right.packet);
+    m_statistics.retransmitted += 2;
+    m_statistics.retransmittedCoded += 2;
+    EnqueueTx(LwsnTxQueue::CODED,ncpacket,Mac48Address::GetBroadcast());
+    ArqExpect(left.packet,LwsnSlotSchedule::LEFT,left.tries);
+    ArqExpect(right.packet,LwsnSlotSchedule::RIGHT,right.tries);
+    left.packet = 0;
+    right.packet = 0;
+  }
+  for(uint32_t i = 0; i < entries.size(); ++i){
+    ArqEntry &entry = entries[i];
+    if(entry.packet == 0){
+      continue;
+    }
+    if(entry.osid != m_sid){
+      LwsnFrameHeader header;
+      entry.packet->PeekHeader(header);
+      RewriteForwardingHeader(entry.packet,header);
+    }
+    ++m_statistics.retransmitted;
+    // a copy, the packet itself stays buffered for decoding and the next try
+    EnqueueTx(LwsnTxQueue::FORWARD,entry.packet->Copy(),(entry.dir == LwsnSlotSchedule::LEFT) ? l_address : r_address);
+    ArqExpect(entry.packet,entry.dir,entry.tries);
+  }
+}
+
+bool
+SimpleNetDevice::ArqAcknowledge(Ptr<const Packet> p,const LwsnFrameHeader &header,Mac48Address from){
+  // p acknowledges the flows it carries whose next hop from here is its sender
+  int towards;
+  if(from == l_address){
+    towards = LwsnSlotSchedule::LEFT;
+  }
+  else if(from == r_address){
+    towards = LwsnSlotSchedule::RIGHT;
   }
   else{
-    ncpacket = encoding(packet,GetRxPacket_1());
-    SetRxPacket_1(0);
+    return false;
+  }
+  uint16_t osids[2] = { header.GetOsid(), header.GetOsid2() };
+  uint32_t n = (header.GetType() == LwsnHeader::NETWORK_CODING) ? 2 : 1;
+
+  LwsnCodingHeader flows;
+  if(n == 2){
+    Ptr<Packet> coded = p->Copy();
+    coded->RemoveAtStart(header.GetSerializedSize());
+    coded->RemoveHeader(flows);
+  }
+
+  bool acknowledged = false;
+  for(uint32_t i = 0; i < n; ++i){
+    if(osids[i] != m_sid && LwsnSlotSchedule::GetDirection(m_sid,osids[i]) != towards){
+      continue;
+    }
+    acknowledged = true;
+    if(n == 1){
+      PeekSequences(p,header.GetSerializedSize(),m_arqSeqs);
+    }
+    else{
+      // the payloads are XORed; the flow this device sent is the one
+      // decoding will XOR back out
+      Ptr<Packet> known = i < flows.GetNFlows() ? FindSent(osids[i],flows.GetSequence(i)) : Ptr<Packet> (0);
+      if(known == 0){
+        continue;
+      }
+      LwsnFrameHeader knownHeader;
+      PeekSequences(known,known->PeekHeader(knownHeader),m_arqSeqs);
+    }
+    // a relay may have packed several of this device's packets into p
+    for(uint32_t j = 0; j < m_arqSeqs.size(); ++j){
+      ArqRemove(osids[i],towards,m_arqSeqs[j]);
+    }
+  }
+  return acknowledged;
+}
+
+void
+SimpleNetDevice::ArqRemove(uint16_t osid,int dir,uint32_t seq){
+  for(std::map<uint64_t, ArqSlot>::iterator it = m_arqSlots.begin(); it != m_arqSlots.end(); ++it){
+    std::vector<ArqEntry> &entries = it->second.entries;
+    std::vector<ArqEntry>::iterator e = entries.begin();
+    while(e != entries.end() && (e->osid != osid || e->dir != dir || e->seq != seq)){
+      ++e;
+    }
+    if(e == entries.end()){
+      continue;
+    }
+    entries.erase(e);
+    if(entries.empty()){
+      it->second.event.Cancel();
+      m_arqSlots.erase(it);
+    }
+    return;
+  }
+}
+
+bool
+SimpleNetDevice::ArqSeen(uint16_t osid,int dir,uint32_t seq){
+  std::map<uint32_t, ArqWindow>::iterator it = m_arqWindows.find(FlowKey(osid,dir));
+  if(it == m_arqWindows.end()){
+    ArqWindow window;
+    window.top = seq;
+    window.mask = 1;
+    m_arqWindows.insert(std::make_pair(FlowKey(osid,dir),window));
+    return false;
+  }
+  ArqWindow &window = it->second;
+  if(seq > window.top){
+    uint32_t shift = seq - window.top;
+    window.mask = (shift < 32) ? (window.mask << shift) | 1 : 1;
+    window.top = seq;
+    return false;
+  }
+  // anything older than the window counts as seen
+  uint32_t age = window.top - seq;
+  if(age >= 32 || (window.mask & (1u << age))){
+    return true;
   }
+  window.mask |= 1u << age;
+  return false;
+}
 
-  NS_LOG_UNCOND("Sid : "<<this->GetSid()<< "  Network coding send");
-  Mac48Address from = Mac48Address::ConvertFrom (m_address);
+bool
+SimpleNetDevice::ArqAccept(Ptr<const Packet> p,const LwsnFrameHeader &header,Mac48Address from){
+  if(!IsOverhearing()){
+    return true;
+  }
+  // the flow travels away from the neighbor it came from
+  int dir = (from == l_address) ? LwsnSlotSchedule::RIGHT : LwsnSlotSchedule::LEFT;
+  uint16_t osid = header.GetOsid();
+  PeekSequences(p,header.GetSerializedSize(),m_arqSeqs);
+
+  // a frame is a duplicate if it brings no reading that is new here
+  bool duplicate = true;
+  for(uint32_t i = 0; i < m_arqSeqs.size(); ++i){
+    if(!ArqSeen(osid,dir,m_arqSeqs[i])){
+      duplicate = false;
+    }
+  }
 
-  Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,ncpacket,0,l_address,from);
- // NS_LOG_UNCOND("Sid : "<<this->GetSid()<< "  Network coding send1");
+  // the sinks forward nothing and a duplicate means the acknowledgement
+  // got lost, so answer with an explicit one: the flow's header and the
+  // readings' sequence numbers, sent back in the next transmit slot
+  if(duplicate || IsSink()){
+    Ptr<Packet> ack = Create<Packet> ();
+    if(m_aggregation){
+      LwsnAggregateHeader readings;
+      for(uint32_t i = 0; i < m_arqSeqs.size(); ++i){
+        readings.AddReading(m_arqSeqs[i],0);
+      }
+      ack->AddHeader(readings);
+    }
+    else{
+      LwsnReadingHeader reading;
+      reading.SetSequence(m_arqSeqs.empty() ? 0 : m_arqSeqs[0]);
+      ack->AddHeader(reading);
+    }
+    LwsnFrameHeader ackHeader;
+    ackHeader.SetType(LwsnHeader::FORWARDING);
+    ackHeader.SetOsid(osid);
+    ackHeader.SetPsid(m_sid);
+    ackHeader.SetE(0);
+    ack->AddHeader(ackHeader);
+    EnqueueTx(LwsnTxQueue::ACK,ack,from);
+  }
+  if(duplicate){
+    LWSN_TRACE (LwsnTrace::DROP, m_sid, osid, 0, p->GetSize ());
+    ++m_statistics.duplicates;
+  }
+  return !duplicate;
+}
 
-  Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,ncpacket,0,r_address,from);
- // NS_LOG_UNCOND("Sid : "<<this->GetSid()<< "  Network coding send2");
+void
+SimpleNetDevice::ScheduleForward(Ptr<Packet> p,Mac48Address next,const LwsnFrameHeader &header,Time wait,uint64_t deadline){
+  if(m_aggregation){
+    int dir = (next == l_address) ? LwsnSlotSchedule::LEFT : LwsnSlotSchedule::RIGHT;
+    uint64_t key = ((uint64_t)FlowKey(header.GetOsid(),dir) << 32) | (deadline & 0xffffffff);
+    std::map<uint64_t, Ptr<Packet> >::iterator it = m_pendingForwards.find(key);
+    if(it != m_pendingForwards.end() && MergeFrames(it->second,p)){
+      ++m_statistics.mergedFrames;
+      return;
+    }
+    // p did not fit; later packets of the slot are packed into p
+    m_pendingForwards[key] = p;
+  }
+  ++m_relayBacklog;
+  Simulator::Schedule(wait,&SimpleNetDevice::ForwardHeld,this,p,next,header);
+}
 
+void
+SimpleNetDevice::ForwardHeld(Ptr<Packet> p,Mac48Address to,LwsnFrameHeader header){
+  --m_relayBacklog;
+  if(m_aggregation){
+    int dir = (to == l_address) ? LwsnSlotSchedule::LEFT : LwsnSlotSchedule::RIGHT;
+    uint64_t deadline = SlotClock();
+    std::map<uint64_t, Ptr<Packet> >::iterator it =
+      m_pendingForwards.find(((uint64_t)FlowKey(header.GetOsid(),dir) << 32) | (deadline & 0xffffffff));
+    if(it != m_pendingForwards.end() && it->second == p){
+      m_pendingForwards.erase(it);
+    }
+  }
+  Forwarding(p,to,header);
 }
 
 void
-SimpleNetDevice::SendCheck(Ptr<Packet> packet,bool *nc_flag){
+SimpleNetDevice::Forwarding(Ptr<Packet> p,Mac48Address to,LwsnFrameHeader header){
+  RewriteForwardingHeader(p,header);
+  RememberSent(p,header);
+  LWSN_TRACE (LwsnTrace::FORWARD, m_sid, header.GetOsid (), 0, p->GetSize ());
+  if(IsOverhearing()){
+    ArqExpect(p,(to == l_address) ? LwsnSlotSchedule::LEFT : LwsnSlotSchedule::RIGHT,0);
+  }
+  EnqueueTx(LwsnTxQueue::FORWARD,p,to);
 
+}
 
-  LwsnHeader tmpHeader;
-  packet->PeekHeader(tmpHeader);
+void 
+SimpleNetDevice::SendSchedule(Ptr<Packet> p,Mac48Address to,Mac48Address from,uint16_t protocolNumber,const LwsnFrameHeader &header)
+{
+  uint16_t osid = header.GetOsid();
+  if(IsSink()){
+    DeliverFrame(p,header);
+    return;
+  }
 
-  //LwsnHeader tmpHeader_1;
-  //GetRxPacket()->PeekHeader(tmpHeader_1);
+  LwsnSlotSchedule::Direction dir = LwsnSlotSchedule::GetDirection(m_sid,osid);
+  const LwsnSlotSchedule::Entry &entry = m_schedule->GetRoute(m_sid,osid);
+  uint64_t now = SlotClock();
+  uint64_t slot = now + m_schedule->GetDelay(m_sid,osid,now);
+  Time wait = UntilSlot(slot);
 
-  NS_LOG_UNCOND("Sid : "<<this->GetSid()<< "SendCheck");
+  if(entry.action == LwsnSlotSchedule::FORWARD){
+    Mac48Address next = (dir == LwsnSlotSchedule::LEFT) ? l_address : r_address;
+    ScheduleForward(p,next,header,wait,slot);
+    return;
+  }
+  if(entry.action != LwsnSlotSchedule::CODE){
+    LWSN_TRACE (LwsnTrace::DROP, m_sid, osid, 0, p->GetSize ());
+    return;
+  }
 
-  if(nc_flag == false){
-    packet->RemoveHeader(tmpHeader);
-    LwsnHeader sendHeader;
-    sendHeader.SetE(0);
-    sendHeader.SetOsid(tmpHeader.GetOsid());
-    sendHeader.SetPsid(m_sid);
-    packet->AddHeader(sendHeader);
-    if(tmpHeader.GetOsid() > m_sid){
-      Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,packet,0,r_address,m_address);
-    }
-    else{
-      Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,packet,0,l_address,m_address);
-    }
+  //networkcoding: one session per (left flow, right flow) pair and slot;
+  //the packets wait in m_rxBuffer under their Osid until the slot comes
+  uint16_t leftOsid = (dir == LwsnSlotSchedule::LEFT) ? osid : entry.partnerOsid;
+  uint16_t rightOsid = (dir == LwsnSlotSchedule::LEFT) ? entry.partnerOsid : osid;
+  uint64_t key = SessionKey(leftOsid,rightOsid,slot);
+  std::map<uint64_t, CodingSession>::iterator it = m_sessions.find(key);
+  if(it == m_sessions.end()){
+    CodingSession session;
+    session.state = CodingSession::WAITING;
+    session.osid[LwsnSlotSchedule::LEFT] = leftOsid;
+    session.osid[LwsnSlotSchedule::RIGHT] = rightOsid;
+    session.present[LwsnSlotSchedule::LEFT] = false;
+    session.present[LwsnSlotSchedule::RIGHT] = false;
+    session.seq[LwsnSlotSchedule::LEFT] = 0;
+    session.seq[LwsnSlotSchedule::RIGHT] = 0;
+    session.held[LwsnSlotSchedule::LEFT] = 0;
+    session.held[LwsnSlotSchedule::RIGHT] = 0;
+    session.deadline = Simulator::Schedule(wait,&SimpleNetDevice::CodingSessionFire,this,key);
+    it = m_sessions.insert(std::make_pair(key,session)).first;
   }
-  else{
-    NetworkCoding(packet);
-    /*if(GetRxPacket_1() != 0){
-      SetRxPacket(GetRxPacket_1());
-      SetRxPacket_1(0);
-    }*/
+  else if(it->second.present[dir]){
+    // a second packet of the same flow for the same slot: send it alone
+    Mac48Address next = (dir == LwsnSlotSchedule::LEFT) ? l_address : r_address;
+    ScheduleForward(p,next,header,wait,slot);
+    return;
+  }
+  uint32_t seq = PeekSequence(p,header.GetSerializedSize());
+  m_rxBuffer.Insert(osid,seq,p,CurrentFrame());
+  ++m_relayBacklog;
+  it->second.present[dir] = true;
+  it->second.seq[dir] = seq;
+  if(it->second.present[LwsnSlotSchedule::LEFT] && it->second.present[LwsnSlotSchedule::RIGHT]){
+    it->second.state = CodingSession::READY;
   }
-  *nc_flag = false;
 }
 
 void
-SimpleNetDevice::Forwarding(Ptr<Packet> p,Mac48Address to){
-  LwsnHeader tempHeader;
-  p->RemoveHeader(tempHeader);
+SimpleNetDevice::TagRemote (Ptr<Packet> packet, uint16_t protocol, Mac48Address to, Mac48Address from)
+{
+  SimpleTag tag;
+  tag.SetSrc (from);
+  tag.SetDst (to);
+  tag.SetProto (protocol);
+  packet->AddPacketTag (tag);
+}
 
-  LwsnHeader sendHeader;
-  sendHeader.SetType(LwsnHeader::FORWARDING);
-  sendHeader.SetPsid(m_sid);
-  sendHeader.SetOsid(tempHeader.GetOsid());
-  sendHeader.SetE(0);
+void
+SimpleNetDevice::ReceiveRemote (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+  SimpleTag tag;
+  bool found = packet->RemovePacketTag (tag);
+  NS_ASSERT_MSG (found, "remote packet without SimpleTag");
+  Receive (packet, tag.GetProto (), tag.GetDst (), tag.GetSrc ());
+}
 
-  p->AddHeader(sendHeader);
-//  SetTxPacket(p);
-  Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,p,0,to,m_address);
+bool
+SimpleNetDevice::IsLocal (void) const
+{
+  return m_node == 0 || m_node->GetSystemId () == Simulator::GetSystemId ();
+}
 
+bool
+SimpleNetDevice::IsOverhearing (void) const
+{
+  return m_arqMaxRetransmissions > 0 && m_codingMode == XOR_CODING;
 }
 
-void
-SimpleNetDevice::OriginalTransmission(Ptr<Packet> p, Mac48Address to, Mac48Address from, uint16_t protocolNumber){
-  LwsnHeader sendHeader;
-  sendHeader.SetType(LwsnHeader::ORIGINAL_TRANSMISSION);
-  sendHeader.SetOsid(m_sid);
-  sendHeader.SetPsid(m_sid);
-  sendHeader.SetE(0);
-  p->AddHeader(sendHeader);
+int64_t
+SimpleNetDevice::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+  m_rlncRng->SetStream (stream);
+  return 1;
+}
 
-  Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,p,0,l_address,m_address);
-  Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,p,0,r_address,m_address);
+SimpleNetDevice::RlncState::RlncState (uint8_t k, uint32_t symbolSize)
+  : generation (k, symbolSize),
+    credit (0),
+    delivered (false)
+{
 }
 
-void 
-SimpleNetDevice::SendSchedule(Ptr<Packet> p,Mac48Address to,Mac48Address from,uint16_t protocolNumber,LwsnHeader header)
-{
-	
-  
-	switch(this->GetSid()){
-		case 1:
-			NS_LOG_UNCOND("Sid : "<<this->GetSid()<<"Receive"<<from);
-		break;
-		case 2:
-			if(header.GetOsid()==1){
-				//networkcoding
-        nc_flag_1 = true;
-        SetRxPacket_1(p);
-				Simulator::Schedule(Seconds(3.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_1);
-			}
-			else if(header.GetOsid()==3){
-				//networkcoding
-        if(nc_flag_1 == false){
-				  Simulator::Schedule(Seconds(1.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_1);
-        }else{
-          SetRxPacket(p);
+SimpleNetDevice::RlncState &
+SimpleNetDevice::GetRlncState (uint32_t id)
+{
+  std::map<uint32_t, RlncState>::iterator it = m_rlncGenerations.find (id);
+  if (it != m_rlncGenerations.end ())
+    {
+      return it->second;
+    }
+  while (m_rlncGenerations.size () >= m_rlncMaxGenerations)
+    {
+      m_rlncGenerations.erase (m_rlncGenerations.begin ());
+    }
+  // the last group of sids may be smaller than a full generation
+  uint32_t groups = (m_schedule->GetNNodes () + m_rlncK - 1) / m_rlncK;
+  uint32_t first = (id % groups) * m_rlncK;
+  uint8_t k = std::min<uint32_t> (m_rlncK, m_schedule->GetNNodes () - first);
+  return m_rlncGenerations.insert (std::make_pair (id, RlncState (k, m_rlncSymbolSize))).first->second;
+}
+
+void
+SimpleNetDevice::RlncReceive (Ptr<Packet> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+  Ptr<Packet> p = packet->Copy ();
+  LwsnFrameHeader header;
+  p->RemoveHeader (header);
+
+  m_codingBuffer.resize (m_rlncSymbolSize);
+  uint32_t id;
+  bool innovative;
+  if (header.GetType () == LwsnHeader::NETWORK_CODING)
+    {
+      LwsnRlncHeader rlnc;
+      p->RemoveHeader (rlnc);
+      id = rlnc.GetGeneration ();
+      RlncState &state = GetRlncState (id);
+      if (rlnc.GetK () != state.generation.GetK () || p->GetSize () != m_rlncSymbolSize)
+        {
+          LWSN_TRACE (LwsnTrace::DROP, m_sid, header.GetOsid (), 0, packet->GetSize ());
+          return;
         }
-			}
-			else if(header.GetOsid()==4){
-				Simulator::Schedule(Seconds(6.0),&SimpleNetDevice::Forwarding,this,p,l_address);
-			}
-			else if(header.GetOsid()==5){
-				Simulator::Schedule(Seconds(5.0),&SimpleNetDevice::Forwarding,this,p,l_address);
-			}
-			else{
-				Simulator::Schedule(Seconds(4.0),&SimpleNetDevice::Forwarding,this,p,l_address);
-			}
-			
-		break;
-		case 3:
-			if(header.GetOsid()==1){
-				//networkcoding
-        nc_flag_2 = true;
-        Simulator::Schedule(Seconds(3.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_2);
-			}
-			else if(header.GetOsid()==2){
-				//networkcoding
-        SetRxPacket_1(p);
-        if(nc_flag_1 == false){
-          Simulator::Schedule(Seconds(3.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_1);
-        }else{
-          SetRxPacket(p);
+      p->CopyData (&m_codingBuffer[0], m_rlncSymbolSize);
+      innovative = state.generation.Add (rlnc.GetCoefficients (), &m_codingBuffer[0]);
+    }
+  else
+    {
+      // an uncoded reading enters its generation as a unit vector
+      uint16_t osid = header.GetOsid ();
+      uint32_t len = p->GetSize ();
+      NS_ABORT_MSG_IF (len + 2 > m_rlncSymbolSize, "payload of " << len << " bytes does not fit RlncSymbolSize");
+      uint32_t groups = (m_schedule->GetNNodes () + m_rlncK - 1) / m_rlncK;
+      uint64_t frame = CurrentFrame ();
+      id = frame * groups + (osid - 1) / m_rlncK;
+      m_codingBuffer[0] = len >> 8;
+      m_codingBuffer[1] = len & 0xff;
+      p->CopyData (&m_codingBuffer[2], len);
+      std::memset (&m_codingBuffer[2 + len], 0, m_rlncSymbolSize - 2 - len);
+      innovative = GetRlncState (id).generation.AddSource ((osid - 1) % m_rlncK, &m_codingBuffer[0]);
+    }
+
+  RlncState &state = GetRlncState (id);
+  if (IsSink ())
+    {
+      if (state.generation.IsComplete () && !state.delivered)
+        {
+          state.delivered = true;
+          uint32_t groups = (m_schedule->GetNNodes () + m_rlncK - 1) / m_rlncK;
+          uint16_t first = (id % groups) * m_rlncK + 1;
+          for (uint8_t i = 0; i < state.generation.GetK (); ++i)
+            {
+              // the last group of the chain may be short
+              if (first + i > m_schedule->GetNNodes ())
+                {
+                  break;
+                }
+              // two length bytes, then the payload
+              const uint8_t *symbol = state.generation.GetSymbol (i);
+              uint32_t size = (symbol[0] << 8) | symbol[1];
+              uint32_t seq = size >= 4 ? LwsnReadingHeader::PeekSequence (symbol + 2) : 0;
+              Deliver (first + i, seq, size);
+            }
         }
-			}
-			else if(header.GetOsid()==4){
-				//networkcoding
-        nc_flag_1 = true;
-        Simulator::Schedule(Seconds(4.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_1);
-			}
-			else if(header.GetOsid()==5){
-				//networkcoding
-        if(nc_flag_2 == false){
-          Simulator::Schedule(Seconds(2.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_2);
-        }else{
-          SetRxPacket_1(p);
+      return;
+    }
+  if (innovative)
+    {
+      ++state.credit;
+      ScheduleRlncSend ();
+    }
+}
+
+void
+SimpleNetDevice::ScheduleRlncSend (void)
+{
+  if (!m_rlncSendEvent.IsRunning ())
+    {
+      uint64_t now = SlotClock ();
+      m_rlncSendEvent = Simulator::Schedule (UntilSlot (now + m_schedule->GetNextTxWait (m_sid, now)),
+                                             &SimpleNetDevice::RlncSend, this);
+    }
+}
+
+void
+SimpleNetDevice::RlncSend (void)
+{
+  NS_LOG_FUNCTION (this);
+  bool more = false;
+  m_codingBuffer.resize (m_rlncSymbolSize);
+  for (std::map<uint32_t, RlncState>::iterator it = m_rlncGenerations.begin (); it != m_rlncGenerations.end (); ++it)
+    {
+      RlncState &state = it->second;
+      if (state.credit == 0)
+        {
+          continue;
         }
-			}
-			else{
-				Simulator::Schedule(Seconds(1.0),&SimpleNetDevice::Forwarding,this,p,l_address);
-			}
-		break;
-		case 4:
-			if(header.GetOsid()==1){
-				Simulator::Schedule(Seconds(3.0),&SimpleNetDevice::Forwarding,this,p,r_address);
-			}
-			else if(header.GetOsid()==2){
-				//networkcoding
-        if(nc_flag_2 == false){
-          Simulator::Schedule(Seconds(3.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_2);
-        }else{
-          SetRxPacket_1(p);
+      uint8_t k = state.generation.GetK ();
+      m_rlncCoeffs.resize (k);
+      m_rlncRandom.resize (k);
+      for (uint8_t i = 0; i < k; ++i)
+        {
+          m_rlncRandom[i] = m_rlncRng->GetInteger (1, 255);
         }
-			}
-			else if(header.GetOsid()==3){
-				//networkcoding
-        if(nc_flag_1 == false){
-          Simulator::Schedule(Seconds(3.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_1);
-        }else{
-          SetRxPacket(p);
+      state.generation.Recode (&m_rlncRandom[0], &m_rlncCoeffs[0], &m_codingBuffer[0]);
+
+      Ptr<Packet> p = LwsnPacketPool::Get ().Acquire (&m_codingBuffer[0], m_rlncSymbolSize);
+      LwsnRlncHeader rlnc;
+      rlnc.SetGeneration (it->first);
+      rlnc.SetCoefficients (&m_rlncCoeffs[0], k);
+      p->AddHeader (rlnc);
+      LwsnFrameHeader sendHeader;
+      sendHeader.SetType (LwsnHeader::NETWORK_CODING);
+      sendHeader.SetOsid (m_sid);
+      sendHeader.SetPsid (m_sid);
+      sendHeader.SetE (1);
+      p->AddHeader (sendHeader);
+
+      EnqueueTx (LwsnTxQueue::CODED, p, Mac48Address::GetBroadcast ());
+
+      --state.credit;
+      more = more || state.credit > 0;
+    }
+  if (more)
+    {
+      ScheduleRlncSend ();
+    }
+}
+
+void
+SimpleNetDevice::Deliver (uint16_t osid, uint32_t seq, uint32_t size)
+{
+  LWSN_TRACE (LwsnTrace::DELIVER, m_sid, osid, 0, size);
+  ++m_statistics.delivered;
+  m_statistics.deliveredBytes += size;
+  m_deliverTrace (osid, seq, size);
+}
+
+void
+SimpleNetDevice::DeliverFrame (Ptr<const Packet> p, const LwsnFrameHeader &header)
+{
+  uint32_t headerSize = header.GetSerializedSize ();
+  if (!m_aggregation)
+    {
+      Deliver (header.GetOsid (), PeekSequence (p, headerSize), p->GetSize () - headerSize);
+      return;
+    }
+  LwsnAggregateHeader readings;
+  if (!PeekReadings (p, headerSize, readings))
+    {
+      LWSN_TRACE (LwsnTrace::DROP, m_sid, header.GetOsid (), 0, p->GetSize ());
+      return;
+    }
+  // sizes as the origin took the readings, sequence number included
+  uint32_t seqSize = LwsnReadingHeader ().GetSerializedSize ();
+  for (uint8_t i = 0; i < readings.GetNReadings (); ++i)
+    {
+      Deliver (header.GetOsid (), readings.GetSequence (i), seqSize + readings.GetSize (i));
+    }
+}
+
+uint32_t
+SimpleNetDevice::PeekSequence (Ptr<const Packet> p, uint32_t headerSize)
+{
+  // an aggregated frame starts with the reading count
+  uint32_t start = headerSize + (m_aggregation ? 1 : 0);
+  uint32_t end = start + 4;
+  if (p->GetSize () < end)
+    {
+      return 0;
+    }
+  m_codingScratch.resize (std::max<uint32_t> (m_codingScratch.size (), end));
+  p->CopyData (&m_codingScratch[0], end);
+  return LwsnReadingHeader::PeekSequence (&m_codingScratch[start]);
+}
+
+bool
+SimpleNetDevice::PeekReadings (Ptr<const Packet> p, uint32_t headerSize, LwsnAggregateHeader &readings)
+{
+  // check the count against the size before deserializing, decoding
+  // with the wrong known packet leaves garbage
+  uint32_t size = p->GetSize ();
+  if (size <= headerSize)
+    {
+      return false;
+    }
+  m_codingScratch.resize (std::max<uint32_t> (m_codingScratch.size (), headerSize + 1));
+  p->CopyData (&m_codingScratch[0], headerSize + 1);
+  uint8_t n = m_codingScratch[headerSize];
+  if (size < headerSize + LwsnAggregateHeader::GetHeaderSize (n))
+    {
+      return false;
+    }
+  Ptr<Packet> copy = p->Copy ();
+  copy->RemoveAtStart (headerSize);
+  copy->RemoveHeader (readings);
+  uint32_t payload = 0;
+  for (uint8_t i = 0; i < n; ++i)
+    {
+      payload += readings.GetSize (i);
+    }
+  return payload <= copy->GetSize ();
+}
+
+void
+SimpleNetDevice::PeekSequences (Ptr<const Packet> p, uint32_t headerSize, std::vector<uint32_t> &seqs)
+{
+  seqs.clear ();
+  if (!m_aggregation)
+    {
+      seqs.push_back (PeekSequence (p, headerSize));
+      return;
+    }
+  LwsnAggregateHeader readings;
+  if (PeekReadings (p, headerSize, readings))
+    {
+      for (uint8_t i = 0; i < readings.GetNReadings (); ++i)
+        {
+          seqs.push_back (readings.GetSequence (i));
         }
-			}
-			else if(header.GetOsid()==5){
-				//networkcoding
-        SetRxPacket_1(p);
-        nc_flag_1 = true;
-        Simulator::Schedule(Seconds(4.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_1);
-			}
-			else{
-				//networkcoding
-        nc_flag_2 = true;
-        Simulator::Schedule(Seconds(4.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_2);
-			}
-		break;
-		case 5:
-			if(header.GetOsid()==1){
-				Simulator::Schedule(Seconds(3.0),&SimpleNetDevice::Forwarding,this,p,r_address);
-			}
-			else if(header.GetOsid()==2){
-				Simulator::Schedule(Seconds(4.0),&SimpleNetDevice::Forwarding,this,p,r_address);
-			}
-			else if(header.GetOsid()==3){
-				Simulator::Schedule(Seconds(5.0),&SimpleNetDevice::Forwarding,this,p,r_address);
-			}
-			else if(header.GetOsid()==4){
-				//networkcoding
-        nc_flag_1 = true;
-        Simulator::Schedule(Seconds(3.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_1);
-			}
-			else{
-				//networkcoding
-        SetRxPacket_1(p);
-        if(nc_flag_1 == false){
-          Simulator::Schedule(Seconds(1.0),&SimpleNetDevice::SendCheck,this,p,&nc_flag_1);
-        }else{
-          SetRxPacket(p);
+    }
+}
+
+bool
+SimpleNetDevice::MergeFrames (Ptr<Packet> frame, Ptr<const Packet> p)
+{
+  LwsnFrameHeader frameHeader;
+  uint32_t frameHeaderSize = frame->PeekHeader (frameHeader);
+  LwsnFrameHeader header;
+  uint32_t headerSize = p->PeekHeader (header);
+  LwsnAggregateHeader frameReadings;
+  LwsnAggregateHeader readings;
+  if (!PeekReadings (frame, frameHeaderSize, frameReadings) || !PeekReadings (p, headerSize, readings))
+    {
+      return false;
+    }
+  uint32_t tail = p->GetSize () - headerSize - readings.GetSerializedSize ();
+  uint32_t n = frameReadings.GetNReadings () + readings.GetNReadings ();
+  if (n > 0xff
+      || frameHeaderSize + LwsnAggregateHeader::GetHeaderSize (n)
+         + frame->GetSize () - frameHeaderSize - frameReadings.GetSerializedSize () + tail > m_mtu)
+    {
+      return false;
+    }
+  Ptr<Packet> payload = p->Copy ();
+  payload->RemoveAtStart (headerSize + readings.GetSerializedSize ());
+  frame->RemoveAtStart (frameHeaderSize + frameReadings.GetSerializedSize ());
+  frame->AddAtEnd (payload);
+  frameReadings.Append (readings);
+  frame->AddHeader (frameReadings);
+  frame->AddHeader (frameHeader);
+  return true;
+}
+
+bool
+SimpleNetDevice::Aggregate (Ptr<Packet> packet, int dir, Mac48Address to, Mac48Address from, uint16_t protocol)
+{
+  LwsnFrameHeader header;
+  packet->RemoveHeader (header);
+  LwsnReadingHeader reading;
+  packet->RemoveHeader (reading);
+
+  OriginFrame &frame = m_originFrames[dir];
+  uint32_t added = LwsnAggregateHeader::GetHeaderSize (1) - LwsnAggregateHeader::GetHeaderSize (0)
+    + packet->GetSize ();
+  if (frame.payload != 0
+      && (frame.readings.GetNReadings () == 0xff
+          || frame.header.GetSerializedSize () + frame.readings.GetSerializedSize ()
+             + frame.payload->GetSize () + added > m_mtu))
+    {
+      // a refused frame is counted as a queue drop; the reading then
+      // starts the next frame all the same
+      CloseOriginFrame (dir);
+    }
+  if (frame.payload == 0)
+    {
+      if (header.GetSerializedSize () + LwsnAggregateHeader::GetHeaderSize (0) + added > m_mtu)
+        {
+          return false;
         }
-			}
-		break;
-		case 6:
-      std::cout<<"sendschedule"<<std::endl;
-			NS_LOG_UNCOND("Sid : "<<this->GetSid()<<"Receive"<<from);
-		break;
-		default:
+      frame.payload = packet;
+      frame.header = header;
+      frame.readings = LwsnAggregateHeader ();
+      frame.to = to;
+      frame.from = from;
+      frame.protocol = protocol;
+    }
+  else
+    {
+      frame.payload->AddAtEnd (packet);
+    }
+  frame.readings.AddReading (reading.GetSequence (), packet->GetSize ());
+  return true;
+}
+
+bool
+SimpleNetDevice::CloseOriginFrame (int dir)
+{
+  OriginFrame &frame = m_originFrames[dir];
+  if (frame.payload == 0)
+    {
+      return true;
+    }
+  Ptr<Packet> packet = frame.payload;
+  frame.payload = 0;
+  packet->AddHeader (frame.readings);
+  packet->AddHeader (frame.header);
+  SimpleTag tag;
+  tag.SetSrc (frame.from);
+  tag.SetDst (frame.to);
+  tag.SetProto (frame.protocol);
+  packet->AddPacketTag (tag);
+  if (!m_txQueue->Enqueue (LwsnTxQueue::ORIGINAL, packet))
+    {
+      ++m_statistics.queueDrops;
+      return false;
+    }
+  return true;
+}
+
+const SimpleNetDevice::Statistics &
+SimpleNetDevice::GetStatistics (void) const
+{
+  return m_statistics;
+}
+
+bool
+SimpleNetDevice::IsSink(void) const
+{
+  return m_sid == 1 || m_sid == m_schedule->GetNNodes();
+}
+
+void
+SimpleNetDevice::SetSlotSchedule(Ptr<LwsnSlotSchedule> schedule)
+{
+  m_schedule = schedule;
+}
+
+Ptr<LwsnSlotSchedule>
+SimpleNetDevice::GetSlotSchedule(void) const
+{
+  return m_schedule;
+}
+
+SimpleNetDevice::RadioState
+SimpleNetDevice::GetRadioState (void) const
+{
+  return m_radioState;
+}
+
+double
+SimpleNetDevice::GetStateEnergy (RadioState state) const
+{
+  NS_ASSERT (state < RADIO_STATES);
+  return m_stateEnergy[state];
+}
 
-		break;
-	}
+double
+SimpleNetDevice::GetTotalEnergy (void) const
+{
+  return m_totalEnergy;
+}
+
+void
+SimpleNetDevice::SetRadioState (RadioState state)
+{
+  Time now = Simulator::Now ();
+  Time duration = now - m_radioStateStart;
+  double current = m_sleepCurrent;
+  switch (m_radioState)
+    {
+    case RADIO_TX:
+      current = m_txCurrent;
+      break;
+    case RADIO_RX:
+      current = m_rxCurrent;
+      break;
+    case RADIO_IDLE:
+      current = m_idleCurrent;
+      break;
+    default:
+      break;
+    }
+  double energy = m_supplyVoltage * current * duration.GetSeconds ();
+  m_stateEnergy[m_radioState] += energy;
+  m_totalEnergy = m_totalEnergy + energy;
+  m_radioStateTrace (m_radioStateStart, duration, m_radioState);
+  NS_LOG_LOGIC ("Sid " << m_sid << " radio " << m_radioState << " -> " << state);
+  m_radioState = state;
+  m_radioStateStart = now;
 }
+
 void
-SimpleNetDevice::SetSleep(){
-  if(m_queue->GetNPackets()>0)
-    Ptr<Packet> packet = m_queue->Dequeue()->GetPacket ();
+SimpleNetDevice::RadioSlot (void)
+{
+  uint64_t now = SlotClock ();
+  uint16_t slot = now % m_schedule->GetFrameLength ();
+  bool tx = m_schedule->IsTxSlot (m_sid, slot);
+  bool rx = m_schedule->IsRxSlot (m_sid, slot);
+  if (rx)
+    {
+      SetRadioState (RADIO_RX);
+    }
+  else if (tx)
+    {
+      // ChannelSend switches to RADIO_TX if anything goes out
+      SetRadioState (RADIO_IDLE);
+    }
+  else
+    {
+      SetRadioState (m_radioSleep ? RADIO_SLEEP : RADIO_IDLE);
+    }
+  uint16_t wait = (tx || rx) ? 1 : m_schedule->GetNextActiveWait (m_sid, now);
+  m_radioEvent = Simulator::Schedule (UntilSlot (now + wait), &SimpleNetDevice::RadioSlot, this);
 }
 void 
 SimpleNetDevice::ChannelSend(Ptr<Packet> p, uint16_t protocol, Mac48Address to, Mac48Address from){
-  NS_LOG_FUNCTION ("Sid"<<this->GetSid() );
+  LWSN_TRACE (LwsnTrace::TX, m_sid, PeekOsid (p), 0, p->GetSize ());
+  SetRadioState(RADIO_TX);
   m_channel->Send(p, protocol, to, from, this);
-  Simulator::Schedule(Seconds(1.0),&SimpleNetDevice::SetSleep,this);
 }
 bool 
 SimpleNetDevice::Send (Ptr<Packet> packet, const Address& dest, uint16_t protocolNumber)
 {
-  //NS_LOG_FUNCTION (this << packet << dest << protocolNumber);
-  //std::cout<<"send"<<std::endl;
   return SendFrom (packet, m_address, dest, protocolNumber);
 }
 
 bool
-SimpleNetDevice::SendFrom (Ptr<Packet> p, const Address& source, const Address& dest, uint16_t protocolNumber)
-{ 
-  //std::cout<<this->GetSid()<<"sendFrom"<<std::endl;	
-  //NS_LOG_FUNCTION (this << p << source << dest << protocolNumber);  
-  if (p->GetSize () > GetMtu ())
+SimpleNetDevice::SendFrom (Ptr<Packet> packet, const Address& source, const Address& dest, uint16_t protocolNumber)
+{
+  // the device tags and queues the caller's packet itself, as the other
+  // ns-3 devices do, rather than copying every reading
+  if (packet->GetSize () > GetMtu ())
     {
       return false;
     }
-  Ptr<Packet> packet = p->Copy ();
 
   Mac48Address to = Mac48Address::ConvertFrom (dest);
   Mac48Address from = Mac48Address::ConvertFrom (source);
 
-  SimpleTag tag;
-  tag.SetSrc (from);
-  tag.SetDst (to);
-  tag.SetProto (protocolNumber);
+  //the packet waits for the device's own slot; one event per device
+  //drains the queue there, whatever the backlog
+  if (m_aggregation)
+    {
+      // packed into the frame towards its neighbor, or towards both for
+      // a broadcast, queued at the latest when the slot comes
+      int dir = (to == r_address) ? LwsnSlotSchedule::RIGHT : LwsnSlotSchedule::LEFT;
+      if (!Aggregate (packet, dir, to, from, protocolNumber))
+        {
+          return false;
+        }
+    }
+  else
+    {
+      SimpleTag tag;
+      tag.SetSrc (from);
+      tag.SetDst (to);
+      tag.SetProto (protocolNumber);
 
-  p->AddPacketTag (tag);
+      packet->AddPacketTag (tag);
 
-  if(m_queue->GetNPackets()>0){
-        p->RemovePacketTag (tag);
-        Simulator::Schedule(Seconds(13.0), &SimpleNetDevice::Send, this, p,dest, protocolNumber);
-        return 0;
-  }
+      if (!m_txQueue->Enqueue (LwsnTxQueue::ORIGINAL, packet))
+        {
+          ++m_statistics.queueDrops;
+          return false;
+        }
+    }
+  ScheduleSlotTransmit ();
+  return true;
+}
 
-  if (m_queue->Enqueue (Create<QueueItem> (p)))
+void
+SimpleNetDevice::SlotTransmit (void)
+{
+  NS_LOG_FUNCTION (this << m_txQueue->GetNPackets ());
+  uint64_t now = SlotClock ();
+  uint16_t slot = now % m_schedule->GetFrameLength ();
+  m_servedClock = now;
+  // the node's own readings go out in the slot the table gives them;
+  // any slot the node transmits in is free of conflicts for relayed frames
+  bool own = slot == m_schedule->GetOriginalSlot (m_sid);
+  if (own)
+    {
+      CloseOriginFrame (LwsnSlotSchedule::LEFT);
+      CloseOriginFrame (LwsnSlotSchedule::RIGHT);
+    }
+  if (own || m_schedule->IsTxSlot (m_sid, slot))
     {
-      if (m_queue->GetNPackets () == 1 && !TransmitCompleteEvent.IsRunning ())
+      LwsnTxQueue::Class worst = own ? LwsnTxQueue::ORIGINAL : LwsnTxQueue::FORWARD;
+      // the slot lasts the airtime of one MaxFrameSize frame, and the
+      // frames sent in it must not run into the next; one-second slots
+      // have no airtime to fill
+      uint32_t room = m_schedule->GetDataRate () > DataRate (0) ? m_schedule->GetMaxFrameSize () : 0xffffffff;
+      for (uint32_t i = 0; i < m_slotCapacity; ++i)
         {
-          p = m_queue->Dequeue ()->GetPacket ();
-          p->RemovePacketTag (tag);
-          Time txTime = Time (0);
-          if (m_bps > DataRate (0))
+          Ptr<const Packet> next = m_txQueue->Peek (worst);
+          if (next == 0 || (i > 0 && next->GetSize () > room))
             {
-              txTime = m_bps.CalculateBytesTxTime (packet->GetSize ());
-            }
-            /*schedule*/
-          int delay=Simulator::Now().GetSeconds();
-    	  int slot=0;
-    	  if(delay==0){
-    	  	slot=0;
-    	  }
-    	  else{
-    	  	slot=delay%13;
-    	  }
-    	  if(this->GetSid()==1 || this->GetSid()==4){
-    	  		if(slot==1){
-    	  			std::cout<<"sendfrom"<<std::endl;
-    	  			Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-    	  		}
-    	  		else if(slot==0){
-    	  			Simulator::Schedule(Seconds(1.0),&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-    	  		}
-    	  		else {
-    	  			delay=14-slot;
-    	  			Simulator::Schedule(Seconds(delay),&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-    	  		}
-    	  }
-    	  else if(this->GetSid()==2 || this->GetSid()==5){
-    	  		if(slot==2){
-    	  			Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-    	  		}
-            else if(slot==1){
-              Simulator::Schedule(Seconds(1.0),&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
+              break;
             }
-    	  		else if(slot==0){
-    	  			Simulator::Schedule(Seconds(2.0),&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-    	  		}
-    	  		else{
-    	  			delay=15-slot;
-    	  			Simulator::Schedule(Seconds(delay),&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-    	  		}
-    	  }
-    	  else {
-    	  		if(slot==3){
-    	  			Simulator::ScheduleNow(&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-    	  		}
-            else if(slot==1){
-              Simulator::Schedule(Seconds(2.0),&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-            }
-            else if(slot==2){
-              Simulator::Schedule(Seconds(1.0),&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
+          room -= std::min (room, next->GetSize ());
+          LwsnTxQueue::Class cls;
+          Ptr<Packet> p = m_txQueue->Dequeue (worst, cls);
+          SimpleTag tag;
+          p->RemovePacketTag (tag);
+          switch (cls)
+            {
+            case LwsnTxQueue::ACK:
+              ++m_statistics.acksSent;
+              ChannelSend (p, tag.GetProto (), tag.GetDst (), tag.GetSrc ());
+              break;
+            case LwsnTxQueue::CODED:
+              ++m_statistics.txCoded;
+              ChannelSend (p, tag.GetProto (), tag.GetDst (), tag.GetSrc ());
+              break;
+            case LwsnTxQueue::FORWARD:
+              ++m_statistics.txForwarded;
+              ChannelSend (p, tag.GetProto (), tag.GetDst (), tag.GetSrc ());
+              break;
+            default:
+              RememberSent (p);
+              ++m_statistics.txOriginal;
+              if (IsOverhearing ())
+                {
+                  if (tag.GetDst () != r_address)
+                    {
+                      ArqExpect (p, LwsnSlotSchedule::LEFT, 0);
+                    }
+                  if (tag.GetDst () != l_address)
+                    {
+                      ArqExpect (p, LwsnSlotSchedule::RIGHT, 0);
+                    }
+                }
+              ChannelSend (p, tag.GetProto (), tag.GetDst (), tag.GetSrc ());
+              break;
             }
-    	  		else if(slot==0){
-    	  			Simulator::Schedule(Seconds(3.0),&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-    	  		}
-    	  		else{
-    	  			delay=16-slot;
-    	  			Simulator::Schedule(Seconds(delay),&SimpleNetDevice::ChannelSend,this,p,protocolNumber,to,from);
-    	  		}
-    	  }
-        SetTxPacket(p);
-      }
-      return true;
+        }
     }
-
-
-  m_channel->Send (packet, protocolNumber, to, from, this);
-  return true;
+  ScheduleSlotTransmit ();
 }
 
-
 void
-SimpleNetDevice::TransmitComplete ()
+SimpleNetDevice::ScheduleSlotTransmit (void)
 {
-  NS_LOG_FUNCTION (this);
-
-  if (m_queue->GetNPackets () == 0)
+  bool relayed = m_txQueue->GetNPackets (LwsnTxQueue::ACK) + m_txQueue->GetNPackets (LwsnTxQueue::CODED)
+    + m_txQueue->GetNPackets (LwsnTxQueue::FORWARD) > 0;
+  bool own = m_txQueue->GetNPackets (LwsnTxQueue::ORIGINAL) > 0
+    || m_originFrames[LwsnSlotSchedule::LEFT].payload != 0
+    || m_originFrames[LwsnSlotSchedule::RIGHT].payload != 0;
+  if (!relayed && !own)
     {
       return;
     }
-
-  Ptr<Packet> packet = m_queue->Dequeue ()->GetPacket ();
-
-  SimpleTag tag;
-  packet->RemovePacketTag (tag);
-
-  Mac48Address src = tag.GetSrc ();
-  Mac48Address dst = tag.GetDst ();
-  uint16_t proto = tag.GetProto ();
-
-  m_channel->Send (packet, proto, dst, src, this);
-
-  if (m_queue->GetNPackets ())
+  // a slot is served once, so frames queued after it wait for the next
+  uint64_t from = SlotClock ();
+  if (from == m_servedClock)
+    {
+      ++from;
+    }
+  uint16_t frameLength = m_schedule->GetFrameLength ();
+  uint16_t wait = frameLength;
+  if (relayed)
+    {
+      wait = m_schedule->IsTxSlot (m_sid, from % frameLength) ? 0 : m_schedule->GetNextTxWait (m_sid, from);
+    }
+  if (own)
     {
-      Time txTime = Time (0);
-      if (m_bps > DataRate (0))
+      wait = std::min (wait, m_schedule->GetDelay (m_sid, m_sid, from));
+    }
+  Time delay = UntilSlot (from + wait);
+  if (m_slotEvent.IsRunning ())
+    {
+      if (Simulator::GetDelayLeft (m_slotEvent) <= delay)
         {
-          txTime = m_bps.CalculateBytesTxTime (packet->GetSize ());
+          return;
         }
-      TransmitCompleteEvent = Simulator::Schedule (txTime, &SimpleNetDevice::TransmitComplete, this);
+      m_slotEvent.Cancel ();
     }
+  m_slotEvent = Simulator::Schedule (delay, &SimpleNetDevice::SlotTransmit, this);
+}
 
-  return;
+bool
+SimpleNetDevice::EnqueueTx (LwsnTxQueue::Class cls, Ptr<Packet> p, Mac48Address to)
+{
+  SimpleTag tag;
+  tag.SetSrc (m_address);
+  tag.SetDst (to);
+  tag.SetProto (0);
+  p->AddPacketTag (tag);
+  if (!m_txQueue->Enqueue (cls, p))
+    {
+      p->RemovePacketTag (tag);
+      ++m_statistics.queueDrops;
+      LWSN_TRACE (LwsnTrace::DROP, m_sid, PeekOsid (p), 0, p->GetSize ());
+      return false;
+    }
+  ScheduleSlotTransmit ();
+  return true;
 }
 
 Ptr<Node> 
@@ -1013,6 +1992,45 @@ SimpleNetDevice::SetReceiveCallback (NetDevice::ReceiveCallback cb)
   m_rxCallback = cb;
 }
 
+void
+SimpleNetDevice::DoInitialize (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_rxBuffer.SetLimits (m_codingBufferDepth, m_codingBufferMaxAge);
+  m_txBuffer.SetLimits (m_codingBufferDepth, m_codingBufferMaxAge);
+  m_radioStateStart = Simulator::Now ();
+  if (m_schedule != 0 && m_schedule->GetDataRate () > DataRate (0))
+    {
+      // a frame coded with a partner grows by the coding header and
+      // still has to fit one slot
+      LwsnCodingHeader pair;
+      pair.AddFlow (0, 0);
+      pair.AddFlow (0, 0);
+      uint32_t maxFrameSize = m_schedule->GetMaxFrameSize ();
+      NS_ABORT_MSG_IF (maxFrameSize <= pair.GetSerializedSize (),
+                       "MaxFrameSize of " << maxFrameSize << " bytes leaves no room for a coded frame");
+      m_mtu = std::min<uint32_t> (m_mtu, maxFrameSize - pair.GetSerializedSize ());
+    }
+  // RLNC generations are numbered by the frame a relay sees a reading in
+  NS_ABORT_MSG_IF (m_codingMode == RLNC_CODING && m_sid != 0
+                   && m_schedule->GetUsedSlots () > m_schedule->GetFrameLength (),
+                   "RLNC coding needs a schedule whose frames do not overlap");
+  NS_ABORT_MSG_IF (m_codingMode == RLNC_CODING && m_aggregation,
+                   "aggregation needs XOR coding");
+  // devices of other partitions are only here to be addressed
+  if (m_sid != 0 && IsLocal ())
+    {
+      // follow the slot table from the next slot boundary on
+      uint64_t next = SlotClock ();
+      if (m_schedule->GetSlotTime (next) < Simulator::Now ())
+        {
+          ++next;
+        }
+      m_radioEvent = Simulator::Schedule (UntilSlot (next), &SimpleNetDevice::RadioSlot, this);
+    }
+  NetDevice::DoInitialize ();
+}
+
 void
 SimpleNetDevice::DoDispose (void)
 {
@@ -1020,11 +2038,31 @@ SimpleNetDevice::DoDispose (void)
   m_channel = 0;
   m_node = 0;
   m_receiveErrorModel = 0;
-  m_queue->DequeueAll ();
-  if (TransmitCompleteEvent.IsRunning ())
+  m_schedule = 0;
+  m_rlncRng = 0;
+  m_rlncGenerations.clear ();
+  for (std::map<uint64_t, CodingSession>::iterator it = m_sessions.begin (); it != m_sessions.end (); ++it)
+    {
+      it->second.deadline.Cancel ();
+    }
+  m_sessions.clear ();
+  m_flowRate.clear ();
+  for (std::map<uint64_t, ArqSlot>::iterator it = m_arqSlots.begin (); it != m_arqSlots.end (); ++it)
     {
-      TransmitCompleteEvent.Cancel ();
+      it->second.event.Cancel ();
     }
+  m_arqSlots.clear ();
+  m_arqWindows.clear ();
+  m_pendingForwards.clear ();
+  m_originFrames[LwsnSlotSchedule::LEFT].payload = 0;
+  m_originFrames[LwsnSlotSchedule::RIGHT].payload = 0;
+  m_rxBuffer.Clear ();
+  m_txBuffer.Clear ();
+  m_rlncSendEvent.Cancel ();
+  m_slotEvent.Cancel ();
+  m_radioEvent.Cancel ();
+  m_txQueue->Dispose ();
+  m_txQueue = 0;
   NetDevice::DoDispose ();
 }
 
@@ -22,15 +22,25 @@
 
 #include <stdint.h>
 #include <string>
+#include <vector>
+#include <map>
 
 #include "ns3/traced-callback.h"
+#include "ns3/traced-value.h"
+#include "ns3/nstime.h"
 #include "ns3/net-device.h"
 #include "ns3/queue.h"
-#include "ns3/data-rate.h"
-#include "ns3/data-rate.h"
+#include "ns3/deprecated.h"
 #include "ns3/event-id.h"
 #include "ns3/network-module.h"
 #include "mac48-address.h"
+#include "lwsn-slot-schedule.h"
+#include "lwsn-rlnc.h"
+#include "lwsn-coding-buffer.h"
+#include "lwsn-aggregate-header.h"
+#include "lwsn-tx-queue.h"
+#include "lwsn-frame-header.h"
+#include "ns3/random-variable-stream.h"
 
 namespace ns3 {
 
@@ -62,6 +72,113 @@ public:
   static TypeId GetTypeId (void);
   SimpleNetDevice ();
 
+  /// How relays combine the packets they hold.
+  enum CodingMode
+  {
+    XOR_CODING,   //!< pairwise XOR of one left-bound and one right-bound flow
+    RLNC_CODING   //!< random linear combinations of a generation over GF(2^8)
+  };
+
+  /// Radio state, set per slot from the slot table.
+  enum RadioState
+  {
+    RADIO_TX = 0,   //!< transmitting
+    RADIO_RX,       //!< listening in a slot a neighbor transmits in
+    RADIO_IDLE,     //!< on, neither sending nor receiving
+    RADIO_SLEEP,    //!< off; packets arriving now are lost
+    RADIO_STATES    //!< number of states
+  };
+
+  /**
+   * TracedCallback signature for radio state changes.
+   *
+   * \param [in] start time the device entered the state
+   * \param [in] duration time spent in the state
+   * \param [in] state the state that ended
+   */
+  typedef void (* RadioStateTracedCallback)(Time start, Time duration, RadioState state);
+
+  /**
+   * \returns the current radio state
+   */
+  RadioState GetRadioState (void) const;
+  /**
+   * \param state a radio state
+   * \returns the energy in joules spent in that state so far, not
+   *          counting the time since the last state change
+   */
+  double GetStateEnergy (RadioState state) const;
+  /**
+   * \returns the energy in joules the radio spent so far, not counting
+   *          the time since the last state change
+   */
+  double GetTotalEnergy (void) const;
+
+  /// Transmission and delivery counters of one device.
+  struct Statistics
+  {
+    Statistics ()
+      : txOriginal (0),
+        txForwarded (0),
+        txCoded (0),
+        delivered (0),
+        deliveredBytes (0),
+        codingSessions (0),
+        codingHits (0),
+        heldPackets (0),
+        holdSlots (0),
+        retransmitted (0),
+        retransmittedCoded (0),
+        arqGiveUps (0),
+        acksSent (0),
+        duplicates (0),
+        mergedFrames (0),
+        queueDrops (0),
+        bufferDrops (0)
+    {
+    }
+    uint64_t txOriginal;      //!< frames sent by the origin of a reading
+    uint64_t txForwarded;     //!< frames relayed uncoded
+    uint64_t txCoded;         //!< coded frames a relay broadcast to both neighbors
+    uint64_t delivered;       //!< readings handed up at this sink
+    uint64_t deliveredBytes;  //!< payload bytes of those readings
+    uint64_t codingSessions;  //!< relay slots planned for a coded pair
+    uint64_t codingHits;      //!< of those, slots that did send a coded pair
+    uint64_t heldPackets;     //!< lone packets held a frame for their partner
+    uint64_t holdSlots;       //!< slots added by those holds
+    uint64_t retransmitted;   //!< packets sent again for lack of an acknowledgement
+    uint64_t retransmittedCoded; //!< of those, packets resent XORed with another
+    uint64_t arqGiveUps;      //!< packets given up after ArqMaxRetransmissions resends
+    uint64_t acksSent;        //!< explicit acknowledgements sent
+    uint64_t duplicates;      //!< readings received again and discarded
+    uint64_t mergedFrames;    //!< relayed frames packed into another of the same flow and slot
+    uint64_t queueDrops;      //!< frames dropped at a full class of the transmit queue
+    uint64_t bufferDrops;     //!< relayed packets lost from the coding buffer before their slot
+  };
+
+  /**
+   * TracedCallback signature for readings delivered at a sink.
+   *
+   * \param [in] osid sid of the node that took the reading
+   * \param [in] seq sequence number of the reading at its origin
+   * \param [in] size payload size in bytes
+   */
+  typedef void (* DeliverTracedCallback)(uint16_t osid, uint32_t seq, uint32_t size);
+
+  /**
+   * \returns the counters of this device
+   */
+  const Statistics &GetStatistics (void) const;
+
+  /**
+   * Assign a fixed random variable stream number to the random variables
+   * used by this model.
+   *
+   * \param stream first stream index to use
+   * \return the number of stream indices assigned by this model
+   */
+  int64_t AssignStreams (int64_t stream);
+
   /**
    * Receive a packet from a connected SimpleChannel.  The 
    * SimpleNetDevice receives packets from its connected channel
@@ -73,6 +190,33 @@ public:
    * \param from address packet was sent from
    */
   void Receive (Ptr<Packet> packet, uint16_t protocol, Mac48Address to, Mac48Address from);
+
+  /**
+   * Attach protocol and addresses to a packet that is to be received by
+   * a device simulated in another partition.
+   *
+   * \param packet the packet, sent on as it is
+   * \param protocol protocol number
+   * \param to address packet should be sent to
+   * \param from address packet was sent from
+   */
+  static void TagRemote (Ptr<Packet> packet, uint16_t protocol, Mac48Address to, Mac48Address from);
+  /**
+   * Receive a packet tagged by TagRemote in another partition.
+   *
+   * \param packet Packet received from the other partition
+   */
+  void ReceiveRemote (Ptr<Packet> packet);
+  /**
+   * \returns true if the node of this device is simulated in this
+   *          partition, always true in a sequential run
+   */
+  bool IsLocal (void) const;
+  /**
+   * \returns true if the device listens to unicasts between its
+   *          neighbors, which it does when hop-by-hop ARQ is on
+   */
+  bool IsOverhearing (void) const;
   
   /**
    * Attach a channel to this net device.  This will be the 
@@ -84,18 +228,25 @@ public:
   void SetChannel (Ptr<SimpleChannel> channel);
 
   /**
-   * Attach a queue to the SimpleNetDevice.
+   * \deprecated The device no longer sends from an ns3::Queue; its
+   * slots are filled from the LwsnTxQueue of the TxClassQueue
+   * attribute.  Aborts.
    *
-   * \param queue Ptr to the new queue.
+   * \param queue ignored
    */
-  void SetQueue (Ptr<Queue> queue);
+  void SetQueue (Ptr<Queue> queue) NS_DEPRECATED;
 
   /**
-   * Get a copy of the attached Queue.
+   * \deprecated See SetQueue; use GetTxClassQueue.  Aborts.
    *
-   * \returns Ptr to the queue.
+   * \returns nothing
+   */
+  Ptr<Queue> GetQueue (void) const NS_DEPRECATED;
+
+  /**
+   * \returns the class-based queue the device sends its slots from
    */
-  Ptr<Queue> GetQueue (void) const;
+  Ptr<LwsnTxQueue> GetTxClassQueue (void) const;
 
   /**
    * Attach a receive ErrorModel to the SimpleNetDevice.
@@ -125,6 +276,17 @@ public:
   virtual bool IsPointToPoint (void) const;
   virtual bool IsBridge (void) const;
   virtual bool Send (Ptr<Packet> packet, const Address& dest, uint16_t protocolNumber);
+  /**
+   * Queue a packet for the device's next transmit slot.  The device
+   * takes the packet over and adds its tags to it; callers must not
+   * modify it afterwards.
+   *
+   * \param packet packet to send
+   * \param source address the frame is sent from
+   * \param dest neighbor address, or broadcast for both neighbors
+   * \param protocolNumber protocol of the payload
+   * \return false if the packet exceeds the MTU or the queue is full
+   */
   virtual bool SendFrom (Ptr<Packet> packet, const Address& source, const Address& dest, uint16_t protocolNumber);
   virtual Ptr<Node> GetNode (void) const;
   virtual void SetNode (Ptr<Node> node);
@@ -139,24 +301,116 @@ public:
   virtual void SetSid(uint16_t sid);
   virtual uint16_t GetSid();
   virtual void SetSideAddress(Address laddress, Address raddress);
-  virtual void SendSchedule(Ptr<Packet> p, Mac48Address to,Mac48Address from,uint16_t protocolNumber,LwsnHeader header);
+  /**
+   * \returns the address of the neighbor towards sid 1
+   */
+  Mac48Address GetLeftAddress(void) const;
+  /**
+   * \returns the address of the neighbor towards sid N
+   */
+  Mac48Address GetRightAddress(void) const;
+  /**
+   * Replace the TDMA slot table; devices of one chain should share it.
+   *
+   * \param schedule the slot table
+   */
+  void SetSlotSchedule(Ptr<LwsnSlotSchedule> schedule);
+  /**
+   * \returns the TDMA slot table the device sends by
+   */
+  Ptr<LwsnSlotSchedule> GetSlotSchedule(void) const;
+  /**
+   * \returns true for the two ends of the chain, which only receive
+   */
+  bool IsSink(void) const;
+  /**
+   * Relay a packet by the slot table: forward it alone or pair it with
+   * its coding partner in the flow's slot.
+   *
+   * \param p the packet, starting with its LwsnHeader
+   * \param to address the packet was sent to
+   * \param from address the packet came from
+   * \param protocolNumber protocol number
+   * \param header the already parsed LwsnHeader of p
+   */
+  virtual void SendSchedule(Ptr<Packet> p, Mac48Address to,Mac48Address from,uint16_t protocolNumber,const LwsnFrameHeader &header);
   virtual void ChannelSend(Ptr<Packet> p, uint16_t protocol,Mac48Address to, Mac48Address from);
-  virtual void SetSleep();
-  void SetRxPacket(Ptr<Packet> p);
-  Ptr<Packet> GetRxPacket(void) const;
-  void SetTxPacket(Ptr<Packet> p);
-  Ptr<Packet> GetRxPacket_1(void) const;
-  void SetRxPacket_1(Ptr<Packet> p);
-  Ptr<Packet> GetTxPacket(void) const;
-  void SetTxPacket_1(Ptr<Packet> p);
-  Ptr<Packet> GetTxPacket_1(void) const;
   Ptr<Packet> encoding(Ptr<Packet> p1, Ptr<Packet> p2);
-  Ptr<Packet> decoding(Ptr<Packet> p);
-  void NetworkCoding(Ptr<Packet> packet);
-  void SendCheck(Ptr<Packet> packet,bool *nc_flag);
-  void Forwarding(Ptr<Packet> p,Mac48Address to);
-  void OriginalTransmission(Ptr<Packet> p, Mac48Address to, Mac48Address from, uint16_t protocolNumber);
+  /**
+   * \param p a coded packet
+   * \param header the parsed LwsnHeader of p; on success replaced by the
+   *        header of the decoded packet
+   * \returns the decoded packet, or p if neither of the packets that were
+   *          coded is still known here
+   */
+  Ptr<Packet> decoding(Ptr<Packet> p, LwsnFrameHeader &header);
+  /**
+   * \param osid origin sid
+   * \param seq sequence number of the packet, its first reading's
+   * \returns the packet of that flow this device sent, or 0 if it is no
+   *          longer buffered
+   */
+  Ptr<Packet> FindSent(uint16_t osid,uint32_t seq);
+  /**
+   * Keep a packet this device sends so that coded packets carrying its
+   * flow can be decoded later.
+   *
+   * \param p the packet, starting with its LwsnHeader
+   */
+  void RememberSent(Ptr<Packet> p);
+  /**
+   * \param p the packet, starting with its LwsnHeader
+   * \param header the parsed LwsnHeader of p, known to the caller
+   */
+  void RememberSent(Ptr<Packet> p, const LwsnFrameHeader &header);
+  void NetworkCoding(Ptr<Packet> packet,Ptr<Packet> partner);
+  /**
+   * Deadline of a coding session: code the pair if both flows arrived,
+   * otherwise forward the one that did.
+   *
+   * \param key the session key
+   */
+  void CodingSessionFire(uint64_t key);
+  /**
+   * Send a flow on alone, as a FORWARDING packet from this relay.
+   *
+   * \param p the packet, starting with its LwsnHeader
+   * \param to next hop
+   * \param header the parsed LwsnHeader of p
+   */
+  void Forwarding(Ptr<Packet> p,Mac48Address to,LwsnFrameHeader header);
+  /**
+   * Forwarding for a packet the relay held until its slot; takes it off
+   * the relay backlog.
+   *
+   * \param p the packet, starting with its LwsnHeader
+   * \param to next hop
+   * \param header the parsed LwsnHeader of p
+   */
+  void ForwardHeld(Ptr<Packet> p,Mac48Address to,LwsnFrameHeader header);
+  /**
+   * Turn the header of p into this relay's FORWARDING header without
+   * parsing or copying the packet.
+   *
+   * \param p the packet, starting with the header described by header
+   * \param header parsed view of the header of p, patched in place
+   */
+  void RewriteForwardingHeader(Ptr<Packet> p, LwsnFrameHeader &header);
+  /**
+   * RLNC mode: add an original or coded packet to its generation, decode
+   * at the sinks and queue a recoded transmission at relays if the packet
+   * was innovative.
+   *
+   * \param packet the received packet, starting with its LwsnHeader
+   */
+  void RlncReceive(Ptr<Packet> packet);
+  /**
+   * RLNC mode: send one recoded packet for every generation that received
+   * innovative packets since the last slot.
+   */
+  void RlncSend(void);
 protected:
+  virtual void DoInitialize (void);
   virtual void DoDispose (void);
 private:
   Ptr<SimpleChannel> m_channel; //!< the channel the device is connected to
@@ -170,14 +424,15 @@ private:
   uint16_t m_sid;
   Mac48Address r_address;
   Mac48Address l_address;
-  uint16_t timeslot;
-  Ptr<Packet> m_rxPacket;
-  Ptr<Packet> m_rxPacket_1;
-  Ptr<Packet> m_txPacket;
-  Ptr<Packet> m_txPacket_1;
-  bool nc_flag_1;
-  bool nc_flag_2;
-  double theta;
+  Ptr<LwsnSlotSchedule> m_schedule; //!< TDMA slot table
+  LwsnCodingBuffer m_rxBuffer; //!< received packets waiting for a coding partner
+  LwsnCodingBuffer m_txBuffer; //!< sent packets, XORed out when decoding
+  uint32_t m_codingBufferDepth;  //!< packets per origin sid in each buffer
+  uint32_t m_codingBufferMaxAge; //!< frames a buffered packet stays usable
+  double m_theta;                 //!< partner chance worth holding a lone packet a frame for
+  std::map<uint32_t, double> m_flowRate; //!< chance each flow arrives for its slot, by FlowKey
+  std::vector<uint8_t> m_codingBuffer;  //!< payload being coded or decoded
+  std::vector<uint8_t> m_codingScratch; //!< second operand of the XOR
   /**
    * The trace source fired when the phy layer drops a packet it has received
    * due to the error model being active.  Although SimpleNetDevice doesn't 
@@ -189,10 +444,346 @@ private:
   TracedCallback<Ptr<const Packet> > m_phyRxDropTrace;
 
   /**
-   * The TransmitComplete method is used internally to finish the process
-   * of sending a packet out on the channel.
+   * Per-generation RLNC state of a device.
+   */
+  struct RlncState
+  {
+    /**
+     * \param k sources in the generation
+     * \param symbolSize bytes per symbol
+     */
+    RlncState (uint8_t k, uint32_t symbolSize);
+    LwsnRlncGeneration generation; //!< received combinations
+    uint32_t credit;               //!< recoded packets still owed downstream
+    bool delivered;                //!< sinks: generation fully decoded
+  };
+
+  /**
+   * \param id generation identifier
+   * \returns the state of the generation, created on first use
+   */
+  RlncState &GetRlncState (uint32_t id);
+  /**
+   * Schedule RlncSend at the device's next transmit slot.
+   */
+  void ScheduleRlncSend (void);
+
+  CodingMode m_codingMode;        //!< XOR or RLNC relaying
+  uint32_t m_rlncK;               //!< sources per RLNC generation
+  uint32_t m_rlncSymbolSize;      //!< bytes per RLNC symbol
+  uint32_t m_rlncMaxGenerations;  //!< generations kept before the oldest is dropped
+  std::map<uint32_t, RlncState> m_rlncGenerations; //!< generations by identifier
+  Ptr<UniformRandomVariable> m_rlncRng; //!< source of coding coefficients
+  EventId m_rlncSendEvent;        //!< pending RlncSend
+  std::vector<uint8_t> m_rlncCoeffs; //!< coefficients of the packet being built
+  std::vector<uint8_t> m_rlncRandom; //!< random factors of the packet being built
+
+  /**
+   * Send up to SlotCapacity queued frames, best class first, in a slot
+   * the device transmits in, as long as their airtime fits the slot; the
+   * node's own readings only go out in its own slot.  Comes back in the next useful slot if a backlog is left.
+   */
+  void SlotTransmit (void);
+
+  /**
+   * Schedule SlotTransmit for the first slot, not yet served, in which
+   * something queued may be sent; keeps an earlier pending one.
+   */
+  void ScheduleSlotTransmit (void);
+
+  /**
+   * Tag a frame for the given neighbor and queue it in its class.
+   *
+   * \param cls traffic class
+   * \param p frame to send
+   * \param to next hop; broadcast for a frame meant for both neighbors
+   * \returns false if the class was full and the frame dropped
+   */
+  bool EnqueueTx (LwsnTxQueue::Class cls, Ptr<Packet> p, Mac48Address to);
+
+  Ptr<LwsnTxQueue> m_txQueue; //!< frames waiting for a transmit slot
+  uint32_t m_slotCapacity; //!< queued frames sent per transmit slot
+  EventId m_slotEvent;     //!< pending SlotTransmit
+  uint64_t m_servedClock;  //!< slot clock of the last SlotTransmit
+
+  /// An origin frame still taking readings before it is queued.
+  struct OriginFrame
+  {
+    Ptr<Packet> payload;          //!< payloads so far, 0 if no frame is open
+    LwsnFrameHeader header;       //!< LwsnHeader of the first reading
+    LwsnAggregateHeader readings; //!< sub-headers so far
+    Mac48Address to;              //!< neighbor the frame goes to, or broadcast for both
+    Mac48Address from;            //!< source address
+    uint16_t protocol;            //!< protocol number
+  };
+
+  /**
+   * Add a reading to the open frame towards its neighbor, queueing that
+   * frame first if the reading does not fit in it.  If the queue refuses
+   * that frame, the reading opens the next one.
+   *
+   * \param packet the reading, starting with its LwsnHeader and
+   *        LwsnReadingHeader
+   * \param dir direction of the neighbor it goes to, LEFT for both
+   * \param to address of that neighbor, or broadcast for both
+   * \param from source address
+   * \param protocol protocol number
+   * \returns false if the reading alone exceeds the MTU
+   */
+  bool Aggregate (Ptr<Packet> packet, int dir, Mac48Address to, Mac48Address from, uint16_t protocol);
+  /**
+   * Queue the open frame towards one neighbor, if there is one.
+   *
+   * \param dir direction of the neighbor
+   * \returns false if the queue refused the frame
+   */
+  bool CloseOriginFrame (int dir);
+  /**
+   * \param p a frame, starting with its LwsnHeader
+   * \param headerSize size of that LwsnHeader
+   * \param readings set to the sub-headers of the readings in p
+   * \returns false if p does not hold a well-formed LwsnAggregateHeader
+   *          and payloads
+   */
+  bool PeekReadings (Ptr<const Packet> p, uint32_t headerSize, LwsnAggregateHeader &readings);
+  /**
+   * \param p a frame, starting with its LwsnHeader
+   * \param headerSize size of that LwsnHeader
+   * \param seqs set to the sequence numbers of the readings in p
+   */
+  void PeekSequences (Ptr<const Packet> p, uint32_t headerSize, std::vector<uint32_t> &seqs);
+  /**
+   * Append the readings of p to frame, if the result fits in the MTU.
+   *
+   * \param frame an aggregated frame of some flow, changed in place
+   * \param p an aggregated frame of the same flow
+   * \returns false if frame was left unchanged
+   */
+  bool MergeFrames (Ptr<Packet> frame, Ptr<const Packet> p);
+  /**
+   * Hold a packet until its slot and forward it there, packed into a
+   * packet of the same flow that is already waiting for that slot if
+   * aggregation is on.
+   *
+   * \param p the packet, starting with its LwsnHeader
+   * \param next next hop
+   * \param header the parsed LwsnHeader of p
+   * \param wait time until the slot
+   * \param deadline slot clock of the slot
+   */
+  void ScheduleForward (Ptr<Packet> p, Mac48Address next, const LwsnFrameHeader &header, Time wait, uint64_t deadline);
+
+  bool m_aggregation;           //!< pack several readings per frame
+  OriginFrame m_originFrames[2]; //!< open origin frames per direction
+  std::map<uint64_t, Ptr<Packet> > m_pendingForwards; //!< forwards waiting for their slot, by flow and slot
+  std::vector<uint32_t> m_arqSeqs; //!< sequence numbers of the frame being acknowledged
+
+  /**
+   * Set the radio state for the slot that starts now and schedule the
+   * next change: one slot later in active slots, otherwise at the next
+   * slot in which the device transmits or listens.
+   */
+  void RadioSlot (void);
+  /**
+   * Charge the time spent in the current state and switch to state.
+   *
+   * \param state the new radio state
+   */
+  void SetRadioState (RadioState state);
+
+  RadioState m_radioState;      //!< current radio state
+  Time m_radioStateStart;       //!< time the current state was entered
+  bool m_radioSleep;            //!< sleep, rather than idle, in inactive slots
+  double m_supplyVoltage;       //!< supply voltage in volts
+  double m_txCurrent;           //!< current draw while transmitting, in amperes
+  double m_rxCurrent;           //!< current draw while listening, in amperes
+  double m_idleCurrent;         //!< current draw while idle, in amperes
+  double m_sleepCurrent;        //!< current draw while asleep, in amperes
+  double m_stateEnergy[RADIO_STATES];  //!< joules spent per state
+  EventId m_radioEvent;         //!< pending RadioSlot
+  TracedValue<double> m_totalEnergy;   //!< joules spent in all states
+  TracedCallback<Time, Time, RadioState> m_radioStateTrace; //!< state changes
+
+  /**
+   * Count a reading that reached this sink and fire the Deliver trace.
+   *
+   * \param osid sid of the node that took the reading
+   * \param seq sequence number of the reading at its origin
+   * \param size payload size in bytes
+   */
+  void Deliver (uint16_t osid, uint32_t seq, uint32_t size);
+  /**
+   * Deliver every reading a frame that reached this sink carries.
+   *
+   * \param p the frame, decoded if it was coded
+   * \param header the parsed LwsnHeader of p
+   */
+  void DeliverFrame (Ptr<const Packet> p, const LwsnFrameHeader &header);
+  /**
+   * \param p a reading
+   * \param headerSize size of its LwsnHeader
+   * \returns the sequence number in the LwsnReadingHeader behind the
+   *          LwsnHeader, or of the first reading of an aggregated
+   *          frame; 0 if the payload is too short to hold one
+   */
+  uint32_t PeekSequence (Ptr<const Packet> p, uint32_t headerSize);
+
+  Statistics m_statistics;      //!< transmission and delivery counters
+  TracedCallback<uint16_t, uint32_t, uint32_t> m_deliverTrace; //!< readings delivered here
+  TracedValue<uint32_t> m_relayBacklog; //!< packets of other nodes waiting for a slot
+
+  /**
+   * \brief Pending pairing of one left-bound and one right-bound flow
+   * for one transmit slot.
+   */
+  struct CodingSession
+  {
+    /// Session progress.
+    enum State
+    {
+      WAITING,  //!< one flow has arrived
+      READY     //!< both flows have arrived, coded at the deadline
+    };
+    uint8_t state;      //!< one of State
+    uint16_t osid[2];   //!< origin sid per LwsnSlotSchedule::Direction
+    bool present[2];    //!< which flows are waiting in m_rxBuffer
+    uint32_t seq[2];    //!< sequence number each present flow is buffered under
+    uint8_t held[2];    //!< frames each present flow was already held for
+    EventId deadline;   //!< the slot in which the session is resolved
+  };
+
+  /**
+   * \param leftOsid origin of the left-bound flow
+   * \param rightOsid origin of the right-bound flow
+   * \param deadline slot clock at which the pair is sent
+   * \returns the key of the session in m_sessions
+   */
+  static uint64_t SessionKey (uint16_t leftOsid, uint16_t rightOsid, uint64_t deadline);
+  /**
+   * Keep the lone packet of a session that is due now for the same
+   * session one frame later.
+   *
+   * \param session the session that is due
+   * \param dir direction of its lone packet
+   * \param key the key the session had
+   * \returns false if the later session already holds a packet of that
+   *          flow, in which case the lone packet has to go now
+   */
+  bool HoldForPartner (const CodingSession &session, int dir, uint64_t key);
+  /**
+   * \param osid origin sid of a flow
+   * \param dir direction of the flow
+   * \returns the key of the flow in m_flowRate
+   */
+  static uint32_t FlowKey (uint16_t osid, int dir);
+
+  std::map<uint64_t, CodingSession> m_sessions; //!< open coding sessions
+
+  /// A packet sent to a neighbor and not acknowledged yet.
+  struct ArqEntry
+  {
+    Ptr<Packet> packet; //!< the packet as sent, starting with its LwsnHeader
+    uint16_t osid;      //!< origin sid of the packet
+    uint32_t seq;       //!< sequence number of the reading
+    uint8_t dir;        //!< LwsnSlotSchedule::Direction it was sent in
+    uint8_t tries;      //!< retransmissions so far
+  };
+
+  /// Packets whose acknowledgement is due by the same slot.
+  struct ArqSlot
+  {
+    std::vector<ArqEntry> entries; //!< packets still unacknowledged
+    EventId event;                 //!< ArqResend for the slot
+  };
+
+  /// Readings of one flow received lately, to discard retransmitted ones.
+  struct ArqWindow
+  {
+    uint32_t top;  //!< highest sequence number seen
+    uint32_t mask; //!< bit i set if top - i was seen
+  };
+
+  /**
+   * Wait one frame for the next hop to acknowledge p, then send it again.
+   *
+   * \param p the packet as sent, starting with its LwsnHeader
+   * \param dir direction it was sent in
+   * \param tries retransmissions of p so far
+   */
+  void ArqExpect (Ptr<Packet> p, int dir, uint8_t tries);
+  /**
+   * Queue the packets due in this slot for resending, XORing a
+   * left-bound and a right-bound one into a single coded frame where both
+   * neighbors can decode it.
+   *
+   * \param due slot clock the packets were due by
+   */
+  void ArqResend (uint64_t due);
+  /**
+   * Take a frame from a neighbor as acknowledgement of the packets it
+   * carries that this device sent that neighbor.
+   *
+   * \param p a received or overheard frame, starting with its LwsnHeader
+   * \param header the parsed LwsnHeader of p
+   * \param from the neighbor that sent p
+   * \returns true if p carries a flow whose next hop from here is
+   *          from, that is if p is an acknowledgement rather than data
+   */
+  bool ArqAcknowledge (Ptr<const Packet> p, const LwsnFrameHeader &header, Mac48Address from);
+  /**
+   * Discard readings received before and acknowledge explicitly where
+   * no forward will: at the sinks and for duplicates.  The
+   * acknowledgement is queued for the device's next transmit slot.
+   *
+   * \param p a reading addressed to this device, decoded if it was coded
+   * \param header the parsed LwsnHeader of p
+   * \param from the neighbor that sent p
+   * \returns false if p is a duplicate
+   */
+  bool ArqAccept (Ptr<const Packet> p, const LwsnFrameHeader &header, Mac48Address from);
+  /**
+   * \param osid origin sid of a flow
+   * \param dir direction of the flow
+   * \param seq sequence number of a reading of the flow
+   * \returns true if the reading was received before; marks it received
+   */
+  bool ArqSeen (uint16_t osid, int dir, uint32_t seq);
+  /**
+   * Forget the unacknowledged packet of a flow that starts with a
+   * reading, if there is one.
+   *
+   * \param osid origin sid of the flow
+   * \param dir direction the packet was sent in
+   * \param seq sequence number of its first reading
+   */
+  void ArqRemove (uint16_t osid, int dir, uint32_t seq);
+
+  uint32_t m_arqMaxRetransmissions; //!< resends per packet, 0 for no ARQ
+  std::map<uint64_t, ArqSlot> m_arqSlots;    //!< unacknowledged packets by due slot
+  std::map<uint32_t, ArqWindow> m_arqWindows; //!< received readings by FlowKey
+
+  /**
+   * \returns the TDMA frame the current time falls in
+   */
+  uint64_t CurrentFrame (void) const;
+
+  /**
+   * \returns the slot clock at the current time
+   */
+  uint64_t SlotClock (void) const;
+
+  /**
+   * \param clock slot clock value
+   * \returns the time from now until that slot starts, zero if it has
+   *          already started
+   */
+  Time UntilSlot (uint64_t clock) const;
+
+  /**
+   * \param osid origin sid of a flow through this device
+   * \returns the slot table entry of the flow at this device
    */
-  void TransmitComplete (void);
+  const LwsnSlotSchedule::Entry &ScheduleEntry (uint16_t osid);
 
   bool m_linkUp; //!< Flag indicating whether or not the link is up
 
@@ -202,9 +793,6 @@ private:
    */
   bool m_pointToPointMode;
 
-  Ptr<Queue> m_queue; //!< The Queue for outgoing packets.
-  DataRate m_bps; //!< The device nominal Data rate. Zero means infinite
-  EventId TransmitCompleteEvent; //!< the Tx Complete event
 
   /**
    * List of callbacks to fire if the link changes state (up or down).